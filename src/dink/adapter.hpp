@@ -0,0 +1,126 @@
+// \file
+// Copyright (c) 2025 Frank Secilia
+// SPDX-License-Identifier: MIT
+//
+// \brief Bases for containers that adapt another for part of a resolution.
+//
+// Overrides, trees, cycle checks, and assisted factories each resolve through
+// a short-lived container wrapping the real one. Each handles a few requests
+// itself and passes the rest on. These bases pass them on, so each adapter
+// defines only what it changes.
+
+#pragma once
+
+#include <dink/lib.hpp>
+#include <dink/handle.hpp>
+#include <dink/meta.hpp>
+#include <utility>
+
+namespace dink {
+
+//! Forwards every request to Container.
+template <typename Container>
+class ForwardingContainer {
+ public:
+  //! Resolves Requested from the underlying container.
+  template <typename Requested>
+  auto resolve() noexcept(
+      noexcept(std::declval<Container&>().template resolve<Requested>()))
+      -> meta::RemoveRvalueRef<Requested> {
+    return container_.template resolve<Requested>();
+  }
+
+  //! Resolves every contribution to the set of Element.
+  template <typename Element>
+  auto resolve_set() -> auto {
+    return container_.template resolve_set<Element>();
+  }
+
+  //! Gets or creates cached entry in the underlying container.
+  template <typename Provider>
+  auto get_or_create(Provider& provider) noexcept(
+      noexcept(std::declval<Container&>().get_or_create(provider)))
+      -> Provider::Provided& {
+    return container_.get_or_create(provider);
+  }
+
+ protected:
+  explicit ForwardingContainer(Container& container) noexcept
+      : container_{container} {}
+
+  Container& container_;
+};
+
+//! Dispatches requests with Derived as the container.
+//
+// Bindings resolved this way see Derived, so the dependencies they request
+// come back through it. Handles resolve later, after Derived is gone, so they
+// bind to the underlying container instead.
+//
+// Derived may hide dispatch() to resolve some requests differently. resolve()
+// calls Derived's.
+template <typename Derived, typename Container, typename Dispatcher,
+          typename Config, typename ParentPtr>
+class DispatchingContainer : public ForwardingContainer<Container> {
+ public:
+  //! Dispatches with Derived as the container; handles bind to the container.
+  template <typename Requested>
+  auto resolve() noexcept(is_nothrow_resolve<Requested>())
+      -> meta::RemoveRvalueRef<Requested> {
+    if constexpr (IsHandle<Requested>) {
+      return this->container_.template resolve<Requested>();
+    } else {
+      return derived().template dispatch<Requested>(derived());
+    }
+  }
+
+  //! Resolves every contribution to the set of Element.
+  template <typename Element>
+  auto resolve_set() -> auto {
+    return dispatch_set<Element>(derived());
+  }
+
+  //! Resolves Requested with its binding, resolving through requesting.
+  template <typename Requested, typename Requesting>
+  auto dispatch(Requesting& requesting) noexcept(noexcept(
+      std::declval<Dispatcher&>().template resolve<Requested>(
+          requesting, std::declval<Config&>(), std::declval<ParentPtr>())))
+      -> meta::RemoveRvalueRef<Requested> {
+    return dispatcher_.template resolve<Requested>(requesting, config_,
+                                                   parent_);
+  }
+
+  //! Resolves the set of Element, resolving through requesting.
+  template <typename Element, typename Requesting>
+  auto dispatch_set(Requesting& requesting) -> auto {
+    return dispatcher_.template resolve_set<Element>(requesting, config_,
+                                                     parent_);
+  }
+
+ protected:
+  DispatchingContainer(Container& container, Dispatcher& dispatcher,
+                       Config& config, ParentPtr parent) noexcept
+      : ForwardingContainer<Container>{container},
+        dispatcher_{dispatcher},
+        config_{config},
+        parent_{parent} {}
+
+  Dispatcher& dispatcher_;
+  Config& config_;
+  ParentPtr parent_;
+
+ private:
+  auto derived() noexcept -> Derived& { return static_cast<Derived&>(*this); }
+
+  template <typename Requested>
+  static constexpr auto is_nothrow_resolve() noexcept -> bool {
+    if constexpr (IsHandle<Requested>) {
+      return noexcept(std::declval<Container&>().template resolve<Requested>());
+    } else {
+      return noexcept(std::declval<Derived&>().template dispatch<Requested>(
+          std::declval<Derived&>()));
+    }
+  }
+};
+
+}  // namespace dink
@@ -0,0 +1,219 @@
+// \file
+// Copyright (c) 2025 Frank Secilia
+// SPDX-License-Identifier: MIT
+//
+// \brief Positional access to the fields of an aggregate.
+//
+// Aggregates are initialized by position, but InjectFields names fields by
+// member pointer. The position of a field is found by binding the fields of an
+// aggregate with a structured binding, then comparing their addresses to the
+// address the member pointer selects, at compile time.
+//
+// A structured binding must name every field, so it is spelled out for each
+// count, up to dink_max_bound_fields.
+
+#pragma once
+
+#include <dink/lib.hpp>
+#include <dink/meta.hpp>
+#include <cstddef>
+#include <memory>
+#include <type_traits>
+#include <utility>
+
+//! Maximum number of fields of an aggregate injecting declared fields.
+#define dink_max_bound_fields 64
+
+// dink_detail_fields_<count>(field) applies field to the names of count
+// bindings. Each case of detail::visit() binds that many fields, then passes
+// either their addresses or the fields themselves.
+
+// clang-format off
+
+#define dink_detail_field_name(name) name
+#define dink_detail_field_address(name) \
+  std::is_reference_v<decltype(name)> ? nullptr : std::addressof(name)
+
+#define dink_detail_fields_1(field) field(f0)
+#define dink_detail_fields_2(field) dink_detail_fields_1(field), field(f1)
+#define dink_detail_fields_3(field) dink_detail_fields_2(field), field(f2)
+#define dink_detail_fields_4(field) dink_detail_fields_3(field), field(f3)
+#define dink_detail_fields_5(field) dink_detail_fields_4(field), field(f4)
+#define dink_detail_fields_6(field) dink_detail_fields_5(field), field(f5)
+#define dink_detail_fields_7(field) dink_detail_fields_6(field), field(f6)
+#define dink_detail_fields_8(field) dink_detail_fields_7(field), field(f7)
+#define dink_detail_fields_9(field) dink_detail_fields_8(field), field(f8)
+#define dink_detail_fields_10(field) dink_detail_fields_9(field), field(f9)
+#define dink_detail_fields_11(field) dink_detail_fields_10(field), field(f10)
+#define dink_detail_fields_12(field) dink_detail_fields_11(field), field(f11)
+#define dink_detail_fields_13(field) dink_detail_fields_12(field), field(f12)
+#define dink_detail_fields_14(field) dink_detail_fields_13(field), field(f13)
+#define dink_detail_fields_15(field) dink_detail_fields_14(field), field(f14)
+#define dink_detail_fields_16(field) dink_detail_fields_15(field), field(f15)
+#define dink_detail_fields_17(field) dink_detail_fields_16(field), field(f16)
+#define dink_detail_fields_18(field) dink_detail_fields_17(field), field(f17)
+#define dink_detail_fields_19(field) dink_detail_fields_18(field), field(f18)
+#define dink_detail_fields_20(field) dink_detail_fields_19(field), field(f19)
+#define dink_detail_fields_21(field) dink_detail_fields_20(field), field(f20)
+#define dink_detail_fields_22(field) dink_detail_fields_21(field), field(f21)
+#define dink_detail_fields_23(field) dink_detail_fields_22(field), field(f22)
+#define dink_detail_fields_24(field) dink_detail_fields_23(field), field(f23)
+#define dink_detail_fields_25(field) dink_detail_fields_24(field), field(f24)
+#define dink_detail_fields_26(field) dink_detail_fields_25(field), field(f25)
+#define dink_detail_fields_27(field) dink_detail_fields_26(field), field(f26)
+#define dink_detail_fields_28(field) dink_detail_fields_27(field), field(f27)
+#define dink_detail_fields_29(field) dink_detail_fields_28(field), field(f28)
+#define dink_detail_fields_30(field) dink_detail_fields_29(field), field(f29)
+#define dink_detail_fields_31(field) dink_detail_fields_30(field), field(f30)
+#define dink_detail_fields_32(field) dink_detail_fields_31(field), field(f31)
+#define dink_detail_fields_33(field) dink_detail_fields_32(field), field(f32)
+#define dink_detail_fields_34(field) dink_detail_fields_33(field), field(f33)
+#define dink_detail_fields_35(field) dink_detail_fields_34(field), field(f34)
+#define dink_detail_fields_36(field) dink_detail_fields_35(field), field(f35)
+#define dink_detail_fields_37(field) dink_detail_fields_36(field), field(f36)
+#define dink_detail_fields_38(field) dink_detail_fields_37(field), field(f37)
+#define dink_detail_fields_39(field) dink_detail_fields_38(field), field(f38)
+#define dink_detail_fields_40(field) dink_detail_fields_39(field), field(f39)
+#define dink_detail_fields_41(field) dink_detail_fields_40(field), field(f40)
+#define dink_detail_fields_42(field) dink_detail_fields_41(field), field(f41)
+#define dink_detail_fields_43(field) dink_detail_fields_42(field), field(f42)
+#define dink_detail_fields_44(field) dink_detail_fields_43(field), field(f43)
+#define dink_detail_fields_45(field) dink_detail_fields_44(field), field(f44)
+#define dink_detail_fields_46(field) dink_detail_fields_45(field), field(f45)
+#define dink_detail_fields_47(field) dink_detail_fields_46(field), field(f46)
+#define dink_detail_fields_48(field) dink_detail_fields_47(field), field(f47)
+#define dink_detail_fields_49(field) dink_detail_fields_48(field), field(f48)
+#define dink_detail_fields_50(field) dink_detail_fields_49(field), field(f49)
+#define dink_detail_fields_51(field) dink_detail_fields_50(field), field(f50)
+#define dink_detail_fields_52(field) dink_detail_fields_51(field), field(f51)
+#define dink_detail_fields_53(field) dink_detail_fields_52(field), field(f52)
+#define dink_detail_fields_54(field) dink_detail_fields_53(field), field(f53)
+#define dink_detail_fields_55(field) dink_detail_fields_54(field), field(f54)
+#define dink_detail_fields_56(field) dink_detail_fields_55(field), field(f55)
+#define dink_detail_fields_57(field) dink_detail_fields_56(field), field(f56)
+#define dink_detail_fields_58(field) dink_detail_fields_57(field), field(f57)
+#define dink_detail_fields_59(field) dink_detail_fields_58(field), field(f58)
+#define dink_detail_fields_60(field) dink_detail_fields_59(field), field(f59)
+#define dink_detail_fields_61(field) dink_detail_fields_60(field), field(f60)
+#define dink_detail_fields_62(field) dink_detail_fields_61(field), field(f61)
+#define dink_detail_fields_63(field) dink_detail_fields_62(field), field(f62)
+#define dink_detail_fields_64(field) dink_detail_fields_63(field), field(f63)
+
+#define dink_detail_field_forward(name) static_cast<decltype(name)&&>(name)
+
+#define dink_detail_visit(count)                                        \
+  else if constexpr (num_fields == count) {                             \
+    auto& [dink_detail_fields_##count(dink_detail_field_name)] =        \
+        aggregate;                                                      \
+    if constexpr (by_address) {                                         \
+      return std::forward<Visitor>(visitor)(                            \
+          dink_detail_fields_##count(dink_detail_field_address));       \
+    } else {                                                            \
+      return std::forward<Visitor>(visitor)(                            \
+          dink_detail_fields_##count(dink_detail_field_forward));       \
+    }                                                                   \
+  }
+
+// clang-format on
+
+namespace dink::aggregate {
+namespace detail {
+
+//! Aggregate whose addresses are compared at compile time.
+//
+// It is never defined, since only the addresses of its fields are used.
+template <typename Aggregate>
+extern Aggregate fake;
+
+// clang-format off
+
+//! Calls visitor with num_fields fields of aggregate, or their addresses.
+template <bool by_address, std::size_t num_fields, typename Aggregate,
+          typename Visitor>
+constexpr auto visit(Aggregate& aggregate, Visitor&& visitor)
+    -> decltype(auto) {
+  static_assert(num_fields <= dink_max_bound_fields,
+                "Too many fields to bind; see dink_max_bound_fields.");
+
+  if constexpr (num_fields == 0) {
+    return std::forward<Visitor>(visitor)();
+  }
+  dink_detail_visit(1) dink_detail_visit(2)
+  dink_detail_visit(3) dink_detail_visit(4)
+  dink_detail_visit(5) dink_detail_visit(6)
+  dink_detail_visit(7) dink_detail_visit(8)
+  dink_detail_visit(9) dink_detail_visit(10)
+  dink_detail_visit(11) dink_detail_visit(12)
+  dink_detail_visit(13) dink_detail_visit(14)
+  dink_detail_visit(15) dink_detail_visit(16)
+  dink_detail_visit(17) dink_detail_visit(18)
+  dink_detail_visit(19) dink_detail_visit(20)
+  dink_detail_visit(21) dink_detail_visit(22)
+  dink_detail_visit(23) dink_detail_visit(24)
+  dink_detail_visit(25) dink_detail_visit(26)
+  dink_detail_visit(27) dink_detail_visit(28)
+  dink_detail_visit(29) dink_detail_visit(30)
+  dink_detail_visit(31) dink_detail_visit(32)
+  dink_detail_visit(33) dink_detail_visit(34)
+  dink_detail_visit(35) dink_detail_visit(36)
+  dink_detail_visit(37) dink_detail_visit(38)
+  dink_detail_visit(39) dink_detail_visit(40)
+  dink_detail_visit(41) dink_detail_visit(42)
+  dink_detail_visit(43) dink_detail_visit(44)
+  dink_detail_visit(45) dink_detail_visit(46)
+  dink_detail_visit(47) dink_detail_visit(48)
+  dink_detail_visit(49) dink_detail_visit(50)
+  dink_detail_visit(51) dink_detail_visit(52)
+  dink_detail_visit(53) dink_detail_visit(54)
+  dink_detail_visit(55) dink_detail_visit(56)
+  dink_detail_visit(57) dink_detail_visit(58)
+  dink_detail_visit(59) dink_detail_visit(60)
+  dink_detail_visit(61) dink_detail_visit(62)
+  dink_detail_visit(63) dink_detail_visit(64)
+}
+
+// clang-format on
+
+}  // namespace detail
+
+//! Calls visitor with a pointer to each of aggregate's num_fields fields.
+//
+// Reference fields have no address of their own, so they are passed as null.
+template <std::size_t num_fields, typename Aggregate, typename Visitor>
+constexpr auto visit_addresses(Aggregate& aggregate, Visitor&& visitor)
+    -> decltype(auto) {
+  return detail::visit<true, num_fields>(aggregate,
+                                         std::forward<Visitor>(visitor));
+}
+
+//! Calls visitor with each of aggregate's num_fields fields.
+//
+// Fields are passed as if forwarded: reference fields as declared, and the
+// rest as rvalues, so they can be moved from.
+template <std::size_t num_fields, typename Aggregate, typename Visitor>
+constexpr auto visit_fields(Aggregate& aggregate, Visitor&& visitor)
+    -> decltype(auto) {
+  return detail::visit<false, num_fields>(aggregate,
+                                          std::forward<Visitor>(visitor));
+}
+
+//! Position of member_ptr among the num_fields fields of its class.
+template <auto member_ptr, std::size_t num_fields>
+inline constexpr std::size_t position = visit_addresses<num_fields>(
+    detail::fake<meta::MemberClass<member_ptr>>, [](auto*... addresses) {
+      const volatile void* const target =
+          std::addressof(detail::fake<meta::MemberClass<member_ptr>>.*
+                         member_ptr);
+      auto result = std::size_t{0};
+      ((static_cast<const volatile void*>(addresses) == target ||
+        (++result, false)) ||
+       ...);
+      return result;
+    });
+
+}  // namespace dink::aggregate
+
+#undef dink_detail_visit
+#undef dink_detail_field_forward
+#undef dink_detail_field_address
+#undef dink_detail_field_name
@@ -14,6 +14,7 @@
 #include <dink/lib.hpp>
 #include <dink/meta.hpp>
 #include <concepts>
+#include <type_traits>
 #include <utility>
 
 //! Controls the maximum arity to check.
@@ -21,6 +22,34 @@
 #define dink_max_deduced_arity 16
 #endif
 
+//! Controls the maximum number of aggregate fields to count.
+#if !defined dink_max_aggregate_fields
+#define dink_max_aggregate_fields 64
+#endif
+
+/*!
+  Checks constructibility using the compiler's trait directly, if available.
+
+  std::is_constructible wraps the same trait, but also instantiates a class
+  and checks completeness for every combination of arguments. That costs more
+  than the trait itself, and search checks up to dink_max_deduced_arity + 1
+  combinations per type.
+*/
+// clang-format off
+#if !defined dink_is_constructible
+  #if defined __has_builtin
+    #if __has_builtin(__is_constructible)
+      #define dink_is_constructible(...) __is_constructible(__VA_ARGS__)
+    #endif
+  #elif defined _MSC_VER
+    #define dink_is_constructible(...) __is_constructible(__VA_ARGS__)
+  #endif
+#endif
+#if !defined dink_is_constructible
+  #define dink_is_constructible(...) std::is_constructible_v<__VA_ARGS__>
+#endif
+// clang-format on
+
 namespace dink {
 
 namespace detail::arity {
@@ -142,24 +171,26 @@ using InitialProbe = std::conditional_t<invoking_constructor && arity == 1,
   constructor.
 
   Generic case checks if Factory(Probes...) produces Resolved.
+
+  This is equivalent to checking std::invoke_result_t when Factory is
+  callable, but a requires expression avoids instantiating std::invoke's
+  machinery for every failed arity.
 */
 template <typename Resolved, typename Factory, typename... Probes>
 struct Match {
   //! true if an arity match is found.
-  static constexpr auto value = []() constexpr {
-    if constexpr (std::is_invocable_v<Factory, Probes...>) {
-      return std::is_same_v<Resolved, std::invoke_result_t<Factory, Probes...>>;
-    } else {
-      return false;
-    }
-  }();
+  static constexpr auto value = requires {
+    {
+      std::declval<Factory>()(std::declval<Probes>()...)
+    } -> std::same_as<Resolved>;
+  };
 };
 
 //! Specialization for void Factory checks if Resolved(Probes...) is invocable.
 template <typename Resolved, typename... Probes>
 struct Match<Resolved, void, Probes...> {
   //! true if an arity match is found.
-  static constexpr auto value = std::is_constructible_v<Resolved, Probes...>;
+  static constexpr auto value = dink_is_constructible(Resolved, Probes...);
 };
 
 /*!
@@ -215,6 +246,11 @@ inline constexpr auto not_found = NotFound::value;
   slices the index sequence, then tries again. The search stops when a
   matching invocation is found, or after arity 0 is tested.
 
+  The search must be linear. Matching arities are not contiguous; a type may
+  have constructors taking 0, 1, and 3 arguments, but not 2. An ascending
+  search stopping at the first failure, or a binary search, would choose a
+  less greedy constructor for such types.
+
   \tparam Resolved The target type to be produced.
   \tparam Factory Either the factory type, or void to search Resolved's
   constructor directly.
@@ -262,21 +298,88 @@ template <typename Resolved, typename Factory, bool invoking_constructor>
 struct Search<Resolved, Factory, invoking_constructor, 0, std::index_sequence<>>
     : std::conditional_t<match<Resolved, Factory>, Found<0>, NotFound> {};
 
+/*!
+  Matches an aggregate against one probe per index.
+
+  \tparam Resolved The aggregate to be initialized.
+  \tparam IndexSequence The std::index_sequence to replace with probes.
+*/
+template <typename Resolved, typename IndexSequence>
+struct AggregateMatch;
+
+//! Zero fields.
+template <typename Resolved>
+struct AggregateMatch<Resolved, std::index_sequence<>>
+    : std::bool_constant<match<Resolved, void>> {};
+
+//! One or more fields; the first probe excludes copy and move ctors.
+template <typename Resolved, std::size_t index,
+          std::size_t... remaining_indices>
+struct AggregateMatch<Resolved,
+                      std::index_sequence<index, remaining_indices...>>
+    : std::bool_constant<
+          match<Resolved, void,
+                InitialProbe<Resolved, true, 1 + sizeof...(remaining_indices)>,
+                IndexedProbe<remaining_indices>...>> {};
+
+/*!
+  Counts aggregate fields by increasing arity.
+
+  Unlike constructors, the arities initializing an aggregate are contiguous:
+  every field after the last one that requires an initializer can be
+  initialized either explicitly or from its default, and no initializer past
+  the last field is accepted. AggregateSearch tests by increasing arity until
+  a match is followed by a mismatch, so it tests one more arity than the
+  aggregate has fields, rather than every arity down from the maximum.
+
+  Counting is limited by dink_max_aggregate_fields rather than
+  dink_max_deduced_arity, so large aggregates of configuration can be
+  injected.
+
+  \tparam Resolved The aggregate to be initialized.
+  \tparam arity The arity being tested.
+  \tparam matched_previous True if arity - 1 matched.
+*/
+template <typename Resolved, std::size_t arity, bool matched_previous>
+struct AggregateSearch
+    : std::conditional_t<
+          AggregateMatch<Resolved, std::make_index_sequence<arity>>::value,
+          AggregateSearch<Resolved, arity + 1, true>,
+          std::conditional_t<matched_previous, Found<arity - 1>,
+                             AggregateSearch<Resolved, arity + 1, false>>> {};
+
+//! Base case: more than dink_max_aggregate_fields, or no match at all.
+template <typename Resolved, bool matched_previous>
+struct AggregateSearch<Resolved, dink_max_aggregate_fields + 2,
+                       matched_previous> : NotFound {};
+
+//! true if Resolved's fields are counted instead of searching ctors.
+template <typename Resolved, typename Factory>
+inline constexpr auto searches_aggregate =
+    std::same_as<Factory, void> && std::is_class_v<Resolved> &&
+    std::is_aggregate_v<Resolved>;
+
 /*!
   Arity of greediest factory or constructor call to produce Resolved.
 
-  If factory is void, Resolved's constructor is investigated. If no matching
-  constructor or call operator is found, the result is not_found.
+  If factory is void, Resolved's constructor is investigated, or its fields are
+  counted if it is an aggregate. If no matching constructor or call operator is
+  found, the result is not_found.
 
   \tparam Resolved The target type to be produced.
   \tparam Factory Either the factory type, or void to search Resolved's
   constructor directly.
 */
 template <typename Resolved, typename Factory>
-inline constexpr std::size_t search =
-    Search<Resolved, Factory, std::same_as<Factory, void>,
-           dink_max_deduced_arity,
-           std::make_index_sequence<dink_max_deduced_arity>>::value;
+inline constexpr std::size_t search = [] {
+  if constexpr (searches_aggregate<Resolved, Factory>) {
+    return AggregateSearch<Resolved, 0, false>::value;
+  } else {
+    return Search<Resolved, Factory, std::same_as<Factory, void>,
+                  dink_max_deduced_arity,
+                  std::make_index_sequence<dink_max_deduced_arity>>::value;
+  }
+}();
 
 /*
   -----------------------------------------------------------------------------
@@ -313,9 +416,16 @@ struct AssertedArity {
   \tparam Resolved The target type to be produced.
   \tparam Factory Either the factory type, or void to search Resolved's
   constructor directly.
+
+  The search is memoized per Resolved and Factory, so every provider producing
+  the same type from the same factory shares one search. Constructor searches
+  are keyed on unqualified Resolved, since cv-qualifiers do not change which
+  constructors are viable.
 */
 template <typename Resolved, typename Factory = void>
-inline constexpr std::size_t arity =
-    detail::arity::AssertedArity<Resolved, Factory>::value;
+inline constexpr std::size_t arity = detail::arity::AssertedArity<
+    std::conditional_t<std::same_as<Factory, void>, std::remove_cv_t<Resolved>,
+                       Resolved>,
+    Factory>::value;
 
 }  // namespace dink
@@ -258,6 +258,55 @@ static_assert(search<TypesExceedingMaxArity::Constructed, void> == not_found);
 static_assert(search<TypesExceedingMaxArity::Constructed,
                      TypesExceedingMaxArity::Factory> == not_found);
 
+/*
+  -----------------------------------------------------------------------------
+  Aggregate Search
+  -----------------------------------------------------------------------------
+*/
+
+struct EmptyAggregate {};
+
+struct SingleFieldAggregate {
+  A0 a0;
+};
+
+struct MultipleFieldAggregate {
+  A0 a0;
+  A1& a1;
+  const A2& a2;
+};
+
+// Fields with defaults may be omitted, but are still counted.
+struct DefaultedFieldAggregate {
+  A0 a0;
+  int_t value = 3;
+  A1* a1 = nullptr;
+};
+
+// Nested aggregates are single fields.
+struct NestedAggregate {
+  SingleFieldAggregate nested;
+  A1 a1;
+};
+
+// More fields than dink_max_deduced_arity.
+struct WideAggregate {
+  A0 a00, a01, a02, a03, a04, a05, a06, a07, a08, a09;
+  A0 a10, a11, a12, a13, a14, a15, a16, a17, a18, a19;
+};
+
+static_assert(searches_aggregate<EmptyAggregate, void>);
+static_assert(!searches_aggregate<EmptyAggregate, Factory<>>);
+static_assert(!searches_aggregate<Constructed<A0>, void>);
+static_assert(!searches_aggregate<int_t, void>);
+
+static_assert(search<EmptyAggregate, void> == 0);
+static_assert(search<SingleFieldAggregate, void> == 1);
+static_assert(search<MultipleFieldAggregate, void> == 3);
+static_assert(search<DefaultedFieldAggregate, void> == 3);
+static_assert(search<NestedAggregate, void> == 2);
+static_assert(search<WideAggregate, void> == 20);
+
 /*
   -----------------------------------------------------------------------------
   arity
@@ -277,5 +326,9 @@ static_assert(dink::arity<Constructed<A0>, void> == 1);
 static_assert(dink::arity<Constructed<A0, A1>, void> == 2);
 static_assert(dink::arity<Constructed<A0, A1, A2>, void> == 3);
 
+// cv-qualified ctor searches share the unqualified search.
+static_assert(dink::arity<const Constructed<A0>, void> == 1);
+static_assert(dink::arity<volatile MultipleArityCtorConstructed, void> == 3);
+
 }  // namespace
 }  // namespace dink::detail::arity
@@ -0,0 +1,287 @@
+// \file
+// Copyright (c) 2025 Frank Secilia
+// SPDX-License-Identifier: MIT
+//
+// \brief Injectable factories combining runtime arguments with resolved ones.
+
+#pragma once
+
+#include <dink/lib.hpp>
+#include <dink/adapter.hpp>
+#include <dink/arity.hpp>
+#include <dink/canonical.hpp>
+#include <dink/fwd.hpp>
+#include <dink/handle.hpp>
+#include <dink/invoker.hpp>
+#include <dink/meta.hpp>
+#include <concepts>
+#include <cstddef>
+#include <memory>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+namespace dink {
+
+namespace detail::assisted {
+
+inline constexpr auto kNoMatch = std::size_t(-1);
+
+//! Index of the runtime argument with the same unqualified type as Requested.
+//
+// \return index into Args, or kNoMatch if no runtime argument matches
+template <typename Requested, typename... Args>
+inline constexpr auto arg_index = []() constexpr {
+  using Unqualified = std::remove_cvref_t<Requested>;
+  constexpr bool matches[] = {
+      std::same_as<Unqualified, std::remove_cvref_t<Args>>..., false};
+  for (auto index = std::size_t{}; index < sizeof...(Args); ++index) {
+    if (matches[index]) return index;
+  }
+  return kNoMatch;
+}();
+
+//! true if no two runtime arguments have the same unqualified type.
+//
+// Each argument's first match is itself only if no earlier argument matches.
+template <typename... Args>
+inline constexpr auto args_are_distinct =
+    []<std::size_t... indices>(std::index_sequence<indices...>) {
+      return ((arg_index<Args, Args...> == indices) && ...);
+    }(std::index_sequence_for<Args...>{});
+
+//! Matches only parameters of type Arg, however qualified.
+//
+// This mirrors arity::detail::Probe, so it matches the same parameters a
+// Resolver would resolve as Arg.
+template <typename Arg>
+struct ArgProbe {
+  template <typename Deduced>
+    requires std::same_as<std::remove_cvref_t<Deduced>, Arg>
+  operator Deduced();
+
+  template <typename Deduced>
+    requires std::same_as<std::remove_cv_t<Deduced>, Arg>
+  operator Deduced&() const;
+};
+
+//! true if the parameter at position can be an Arg.
+//
+// This probes position with ArgProbe and every other index with a match-any
+// Probe, so it is precise unless several overloads of the same arity exist.
+template <typename Arg, typename Constructed, typename ConstructedFactory,
+          std::size_t position, std::size_t... indices>
+inline constexpr auto takes_arg = arity::Match<
+    Constructed, ConstructedFactory,
+    std::conditional_t<indices == position, ArgProbe<Arg>,
+                       arity::Probe>...>::value;
+
+//! Number of parameters of TargetInvoker's target that can be an Arg.
+template <typename Arg, typename TargetInvoker>
+inline constexpr auto num_uses = std::size_t{0};
+
+template <typename Arg, typename Constructed, typename ConstructedFactory,
+          typename ResolverSequence, std::size_t... indices>
+inline constexpr auto num_uses<
+    Arg, Invoker<Constructed, ConstructedFactory, ResolverSequence,
+                 std::index_sequence<indices...>>> =
+    (std::size_t{0} + ... +
+     takes_arg<Arg, Constructed, ConstructedFactory, indices, indices...>);
+
+//! Declared parameters are counted exactly.
+template <typename Arg, typename Constructed, typename ConstructedFactory,
+          typename Return, typename... Params, std::size_t... indices>
+inline constexpr auto num_uses<
+    Arg, Invoker<Constructed, ConstructedFactory,
+                 DeclaredResolverSequence<Return(Params...)>,
+                 std::index_sequence<indices...>>> =
+    (std::size_t{0} + ... +
+     std::same_as<std::remove_cvref_t<Params>, Arg>);
+
+//! Declared fields are counted exactly.
+template <typename Arg, typename Constructed, auto... fields>
+inline constexpr auto num_uses<
+    Arg, FieldInvoker<Constructed, InjectFields<fields...>>> =
+    (std::size_t{0} + ... +
+     std::same_as<std::remove_cv_t<meta::MemberType<fields>>, Arg>);
+
+//! Container adapter that supplies runtime arguments before resolving.
+//
+// This lives on the stack for the duration of one factory call. Resolvers
+// created by the Invoker see it as the container. Requests whose unqualified
+// type matches a runtime argument get that argument; everything else is
+// forwarded to the real container. Only the constructed type's direct
+// parameters see the runtime arguments; its dependencies resolve from the
+// real container.
+//
+// Lvalue reference parameters bind to an argument. Value and rvalue reference
+// parameters consume it, moving from it unless it was passed by lvalue
+// reference. An argument passed by value or rvalue reference may be forwarded
+// to only one parameter, since any other would see it moved from. Invokers
+// check that at compile time, through check_invoker().
+template <typename Container, typename... Args>
+class ArgumentContainer : public ForwardingContainer<Container> {
+ public:
+  //! Resolves Requested from a matching argument, or the real container.
+  template <typename Requested>
+  auto resolve() -> meta::RemoveRvalueRef<Requested> {
+    constexpr auto index = arg_index<Requested, Args...>;
+    if constexpr (index == kNoMatch) {
+      return ArgumentContainer::ForwardingContainer::template resolve<
+          Requested>();
+    } else if constexpr (std::is_lvalue_reference_v<Requested>) {
+      return std::get<index>(args_);
+    } else {
+      using Arg = std::tuple_element_t<index, std::tuple<Args...>>;
+      return static_cast<Arg&&>(std::get<index>(args_));
+    }
+  }
+
+  //! Creates Requested with its binding in the real container, if it has one.
+  template <typename Requested>
+  auto create() -> Requested {
+    if constexpr (requires {
+                    this->container_.template create<Requested>(
+                        std::declval<ArgumentContainer&>());
+                  }) {
+      return this->container_.template create<Requested>(*this);
+    } else {
+      const auto invoker = InvokerFactory<Invoker>{}
+                               .template create<Canonical<Requested>, void>();
+      return invoker.template create<Requested>(*this);
+    }
+  }
+
+  //! Fails to compile if TargetInvoker would forward an argument twice.
+  //
+  // \sa invoker::check()
+  template <typename TargetInvoker>
+  static constexpr auto check_invoker() noexcept -> void {
+    static_assert(
+        ((std::is_lvalue_reference_v<Args> ||
+          num_uses<std::remove_cvref_t<Args>, TargetInvoker> <= 1) &&
+         ...),
+        "AssistedFactory forwards a runtime argument to more than one "
+        "parameter, but it is passed by value or rvalue reference, so "
+        "it is moved into the first. Pass it by lvalue reference to share it.");
+  }
+
+  explicit ArgumentContainer(Container& container, Args&&... args) noexcept
+      : ArgumentContainer::ForwardingContainer{container},
+        args_{std::forward<Args>(args)...} {}
+
+ private:
+  std::tuple<Args&&...> args_;
+};
+
+//! Creates Result through its binding from runtime arguments and container.
+template <typename Result, typename Container, typename... Args>
+auto create(Container& container, Args&&... args) -> Result {
+  auto argument_container = ArgumentContainer<Container, Args...>{
+      container, std::forward<Args>(args)...};
+  return argument_container.template create<Result>();
+}
+
+}  // namespace detail::assisted
+
+// ----------------------------------------------------------------------------
+// AssistedFactory
+// ----------------------------------------------------------------------------
+
+//! Creates instances from runtime arguments and container-resolved ones.
+//
+// AssistedFactory<Result(Args...), Container> creates Result with the
+// provider Canonical<Result> is bound to, so .as<Impl>() and factory bindings
+// apply; unbound types are constructed with their greediest constructor, as
+// provider::Ctor does. The binding's scope is bypassed: every call creates a
+// new instance. Parameters whose unqualified type matches one of Args receive
+// that runtime argument; the rest are resolved from the container. Result may
+// be a value, unique_ptr, or shared_ptr. The runtime argument types must be
+// distinct.
+//
+// No child container is created and nothing is allocated per call, beyond
+// what Result itself requires.
+//
+// Like Provider, when Container is given the call is direct and inlinable,
+// and when Container is AnyContainer, the factory can be injected from any
+// container and calls through a function pointer.
+template <typename Signature, typename Container>
+class AssistedFactory;
+
+//! Specialization for a typed Container.
+template <typename Result, typename... Args, typename Container>
+class AssistedFactory<Result(Args...), Container> {
+ public:
+  static_assert(detail::assisted::args_are_distinct<Args...>,
+                "AssistedFactory runtime argument types must be distinct.");
+
+  //! Constructs Result using args.
+  auto operator()(Args... args) const -> Result {
+    return detail::assisted::create<Result>(*container_,
+                                            std::forward<Args>(args)...);
+  }
+
+  explicit constexpr AssistedFactory(Container& container) noexcept
+      : container_{std::addressof(container)} {}
+
+ private:
+  Container* container_;
+};
+
+//! Specialization for AnyContainer creates from any container.
+template <typename Result, typename... Args>
+class AssistedFactory<Result(Args...), AnyContainer> {
+ public:
+  static_assert(detail::assisted::args_are_distinct<Args...>,
+                "AssistedFactory runtime argument types must be distinct.");
+
+  //! Constructs Result using args.
+  auto operator()(Args... args) const -> Result {
+    return create_(container_, std::forward<Args>(args)...);
+  }
+
+  template <typename Container>
+    requires(!std::same_as<std::remove_cvref_t<Container>, AssistedFactory>)
+  explicit constexpr AssistedFactory(Container& container) noexcept
+      : container_{std::addressof(container)}, create_{&create<Container>} {}
+
+ private:
+  using CreateFunction = auto (*)(void* container, Args&&... args) -> Result;
+
+  //! Creates from the concrete container type.
+  template <typename Container>
+  static auto create(void* container, Args&&... args) -> Result {
+    return detail::assisted::create<Result>(
+        *static_cast<Container*>(container), std::forward<Args>(args)...);
+  }
+
+  void* container_;
+  CreateFunction create_;
+};
+
+// ----------------------------------------------------------------------------
+// Concepts
+// ----------------------------------------------------------------------------
+
+namespace traits {
+
+//! AssistedFactory is a handle; it is created from the requesting container.
+template <typename Signature, typename Container>
+struct IsHandle<AssistedFactory<Signature, Container>> : std::true_type {};
+
+}  // namespace traits
+
+// ----------------------------------------------------------------------------
+// Canonical
+// ----------------------------------------------------------------------------
+
+namespace canonical::detail {
+
+//! Removes AssistedFactory.
+template <typename Result, typename... Args, typename Container>
+struct Canonical<AssistedFactory<Result(Args...), Container>>
+    : Canonical<Result> {};
+
+}  // namespace canonical::detail
+
+}  // namespace dink
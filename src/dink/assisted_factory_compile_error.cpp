@@ -0,0 +1,33 @@
+// \file
+// Copyright (c) 2025 Frank Secilia
+// SPDX-License-Identifier: MIT
+//
+// Must fail to compile, since a runtime argument passed by value would be
+// moved into one parameter, then forwarded to another.
+//
+// Built on demand by the dink_assisted_factory_compile_error test.
+
+#include <dink/assisted_factory.hpp>
+#include <dink/container.hpp>
+#include <string>
+
+namespace dink {
+namespace {
+
+struct Greeting {
+  Greeting(std::string name, const std::string& same_name) noexcept
+      : name{std::move(name)}, same_name{same_name} {}
+
+  std::string name;
+  const std::string& same_name;
+};
+
+[[maybe_unused]] auto create_greeting() -> void {
+  auto container = Container{};
+  auto factory = container.resolve<AssistedFactory<Greeting(std::string),
+                                                   decltype(container)>>();
+  factory("name");
+}
+
+}  // namespace
+}  // namespace dink
@@ -0,0 +1,225 @@
+// \file
+// Copyright (c) 2025 Frank Secilia
+// SPDX-License-Identifier: MIT
+
+#include "assisted_factory.hpp"
+#include <dink/test.hpp>
+#include <string>
+
+namespace dink {
+namespace {
+
+struct AssistedFactoryTest : Test {
+  static constexpr auto kDependencyValue = int_t{3613};  // Arbitrary.
+  static constexpr auto kId = int_t{9152};               // Arbitrary.
+
+  struct Dependency {
+    int_t value = kDependencyValue;
+  };
+
+  // Counts resolves and returns a cached instance or a new value.
+  struct Container {
+    int_t num_resolves = 0;
+    Dependency instance{};
+
+    template <typename Requested>
+    auto resolve() -> meta::RemoveRvalueRef<Requested> {
+      ++num_resolves;
+      if constexpr (std::is_lvalue_reference_v<Requested>) {
+        return instance;
+      } else {
+        return Dependency{};
+      }
+    }
+  };
+  Container container;
+
+  // Runtime arguments interleaved with resolved dependencies.
+  struct Constructed {
+    int_t id;
+    Dependency dependency;
+    std::string name;
+    Dependency& shared;
+  };
+
+  struct MoveOnlyArg {
+    std::unique_ptr<int_t> value;
+  };
+
+  struct ConstructedFromMoveOnly {
+    Dependency dependency;
+    MoveOnlyArg arg;
+  };
+
+  struct ConstructedFromOneArg {
+    explicit ConstructedFromOneArg(int_t id) : id{id} {}
+    int_t id;
+  };
+
+  // Takes the same runtime argument twice.
+  struct ConstructedFromTwoIds {
+    ConstructedFromTwoIds(int_t& id, const int_t& same_id)
+        : address{&id}, same_address{&same_id} {}
+    int_t* address;
+    const int_t* same_address;
+  };
+
+  // Takes the runtime argument by lvalue reference.
+  struct ConstructedFromLvalueRef {
+    ConstructedFromLvalueRef(int_t& id, Dependency& shared)
+        : id{id}, address{&id}, shared{shared} {}
+    int_t id;
+    int_t* address;
+    Dependency& shared;
+  };
+};
+
+static_assert(std::is_trivially_copyable_v<
+              AssistedFactory<AssistedFactoryTest::Constructed(int_t),
+                              AssistedFactoryTest::Container>>);
+static_assert(sizeof(AssistedFactory<AssistedFactoryTest::Constructed(int_t),
+                                     AssistedFactoryTest::Container>) ==
+              sizeof(void*));
+
+static_assert(
+    std::same_as<Canonical<AssistedFactory<
+                     std::unique_ptr<AssistedFactoryTest::Constructed>(),
+                     AnyContainer>>,
+                 AssistedFactoryTest::Constructed>);
+
+static_assert(IsHandle<AssistedFactory<int_t(int_t), AnyContainer>>);
+
+static_assert(detail::assisted::args_are_distinct<>);
+static_assert(detail::assisted::args_are_distinct<int_t, const char*>);
+static_assert(!detail::assisted::args_are_distinct<int_t, const int_t&>);
+
+static_assert(detail::assisted::num_uses<
+                  int_t, Invoker<AssistedFactoryTest::Constructed, void,
+                                 ResolverSequence<Resolver, SingleArgResolver>,
+                                 std::make_index_sequence<4>>> == 1);
+static_assert(detail::assisted::num_uses<
+                  int_t, Invoker<AssistedFactoryTest::ConstructedFromTwoIds,
+                                 void,
+                                 ResolverSequence<Resolver, SingleArgResolver>,
+                                 std::make_index_sequence<2>>> == 2);
+static_assert(
+    detail::assisted::num_uses<
+        int_t, Invoker<AssistedFactoryTest::ConstructedFromTwoIds, void,
+                       DeclaredResolverSequence<void(int_t&, const int_t&)>,
+                       std::make_index_sequence<2>>> == 2);
+
+// ----------------------------------------------------------------------------
+// Typed Container
+// ----------------------------------------------------------------------------
+
+TEST_F(AssistedFactoryTest, typed_does_not_resolve_until_called) {
+  [[maybe_unused]] const auto sut =
+      AssistedFactory<Constructed(int_t, std::string), Container>{container};
+
+  ASSERT_EQ(0, container.num_resolves);
+}
+
+TEST_F(AssistedFactoryTest, typed_forwards_args_to_matching_positions) {
+  const auto sut =
+      AssistedFactory<Constructed(std::string, int_t), Container>{container};
+
+  const auto result = sut("name", kId);
+
+  ASSERT_EQ(kId, result.id);
+  ASSERT_EQ(kDependencyValue, result.dependency.value);
+  ASSERT_EQ("name", result.name);
+  ASSERT_EQ(&container.instance, &result.shared);
+  ASSERT_EQ(2, container.num_resolves);
+}
+
+TEST_F(AssistedFactoryTest, typed_moves_move_only_args) {
+  const auto sut =
+      AssistedFactory<ConstructedFromMoveOnly(MoveOnlyArg), Container>{
+          container};
+
+  const auto result = sut(MoveOnlyArg{std::make_unique<int_t>(kId)});
+
+  ASSERT_EQ(kId, *result.arg.value);
+  ASSERT_EQ(kDependencyValue, result.dependency.value);
+}
+
+TEST_F(AssistedFactoryTest, typed_creates_from_single_arg) {
+  const auto sut =
+      AssistedFactory<ConstructedFromOneArg(int_t), Container>{container};
+
+  ASSERT_EQ(kId, sut(kId).id);
+  ASSERT_EQ(0, container.num_resolves);
+}
+
+TEST_F(AssistedFactoryTest, typed_binds_lvalue_ref_params_to_value_args) {
+  const auto sut =
+      AssistedFactory<ConstructedFromLvalueRef(int_t), Container>{container};
+
+  const auto result = sut(kId);
+
+  ASSERT_EQ(kId, result.id);
+  ASSERT_EQ(&container.instance, &result.shared);
+}
+
+TEST_F(AssistedFactoryTest, typed_binds_lvalue_ref_params_to_ref_args) {
+  const auto sut =
+      AssistedFactory<ConstructedFromLvalueRef(int_t&), Container>{container};
+  auto id = kId;
+
+  const auto result = sut(id);
+
+  ASSERT_EQ(&id, result.address);
+}
+
+TEST_F(AssistedFactoryTest, typed_shares_lvalue_ref_args) {
+  const auto sut =
+      AssistedFactory<ConstructedFromTwoIds(int_t&), Container>{container};
+  auto id = kId;
+
+  const auto result = sut(id);
+
+  ASSERT_EQ(&id, result.address);
+  ASSERT_EQ(&id, result.same_address);
+}
+
+TEST_F(AssistedFactoryTest, typed_creates_unique_ptr) {
+  const auto sut =
+      AssistedFactory<std::unique_ptr<Constructed>(int_t, std::string),
+                      Container>{container};
+
+  const auto result = sut(kId, "name");
+
+  ASSERT_EQ(kId, result->id);
+  ASSERT_EQ("name", result->name);
+}
+
+// ----------------------------------------------------------------------------
+// Untyped Container
+// ----------------------------------------------------------------------------
+
+TEST_F(AssistedFactoryTest, untyped_forwards_args_to_matching_positions) {
+  const auto sut =
+      AssistedFactory<Constructed(int_t, std::string), AnyContainer>{
+          container};
+
+  const auto result = sut(kId, "name");
+
+  ASSERT_EQ(kId, result.id);
+  ASSERT_EQ(kDependencyValue, result.dependency.value);
+  ASSERT_EQ("name", result.name);
+  ASSERT_EQ(&container.instance, &result.shared);
+}
+
+TEST_F(AssistedFactoryTest, untyped_creates_shared_ptr) {
+  const auto sut =
+      AssistedFactory<std::shared_ptr<Constructed>(int_t, std::string),
+                      AnyContainer>{container};
+
+  const auto result = sut(kId, "name");
+
+  ASSERT_EQ(kId, result->id);
+  ASSERT_EQ(&container.instance, &result->shared);
+}
+
+}  // namespace
+}  // namespace dink
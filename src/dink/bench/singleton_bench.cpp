@@ -0,0 +1,68 @@
+// \file
+// Copyright (c) 2025 Frank Secilia
+// SPDX-License-Identifier: MIT
+//
+// \brief Measures steady-state access to many distinct cached singletons.
+//
+// Each iteration resolves every singleton once, as a reference. After the
+// first iteration, every access is a cache hit, so this measures the cached
+// access path, and how much of each call site the one-time construction path
+// occupies.
+
+#include <dink/lib.hpp>
+#include <dink/cache.hpp>
+#include <dink/container.hpp>
+#include <benchmark/benchmark.h>
+#include <cstddef>
+#include <utility>
+
+namespace dink {
+namespace {
+
+constexpr auto kNumSingletons = std::size_t{256};
+
+template <std::size_t id>
+struct Leaf {
+  int_t value;
+  Leaf() : value{static_cast<int_t>(id)} {}
+};
+
+// Singleton with its own dependencies, so construction is not trivial.
+template <std::size_t id>
+struct Node {
+  int_t value;
+  Node(Leaf<id>& leaf, Leaf<id> copy) : value{leaf.value + copy.value} {}
+};
+
+template <typename Container, std::size_t... ids>
+auto resolve_all(Container& container, std::index_sequence<ids...>) -> int_t {
+  return (container.template resolve<Node<ids>&>().value + ...);
+}
+
+template <typename Container>
+auto run(benchmark::State& state, Container& container) -> void {
+  constexpr auto ids = std::make_index_sequence<kNumSingletons>{};
+  benchmark::DoNotOptimize(resolve_all(container, ids));
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(resolve_all(container, ids));
+  }
+  state.SetItemsProcessed(state.iterations() *
+                          static_cast<int64_t>(kNumSingletons));
+}
+
+auto cache_type(benchmark::State& state) -> void {
+  auto container = Container{};
+  run(state, container);
+}
+BENCHMARK(cache_type);
+
+auto cache_instance(benchmark::State& state) -> void {
+  auto container = Container<Config<>, cache::Instance>{};
+  run(state, container);
+}
+BENCHMARK(cache_instance);
+
+}  // namespace
+}  // namespace dink
+
+BENCHMARK_MAIN();
@@ -14,6 +14,7 @@
 stateDiagram-v2
     [*] --> BindBuilder : bind<From>()
 
+    BindBuilder --> BindBuilder : .named<Qualifier>()
     BindBuilder --> AsBuilder : .as<To>()
     BindBuilder --> ViaBuilder : .via(factory)
     BindBuilder --> InBuilder : .in<Scope>()
@@ -35,6 +36,7 @@ stateDiagram-v2
 
 #include <dink/lib.hpp>
 #include <dink/binding.hpp>
+#include <dink/named.hpp>
 #include <dink/provider.hpp>
 #include <dink/scope.hpp>
 #include <type_traits>
@@ -62,9 +64,19 @@ class InBuilder;
 // ----------------------------------------------------------------------------
 
 //! Initial state after bind<From>().
+//
+// When From is qualified, NamedKey<Qualifier, Type>, the constructed type is
+// the unqualified Type.
 template <typename From>
 class BindBuilder {
  public:
+  // Qualify From (From -> NamedKey<Qualifier, From>)
+  template <typename Qualifier>
+    requires(std::same_as<From, Unqualified<From>>)
+  constexpr auto named() && -> BindBuilder<NamedKey<Qualifier, From>> {
+    return {};
+  }
+
   // Specify To type (From -> To mapping)
   template <typename To>
   constexpr auto as() && -> AsBuilder<From, To> {
@@ -80,19 +92,22 @@ class BindBuilder {
 
   // Specify scope with Ctor<From> provider
   template <typename Scope>
-  constexpr auto in() && -> InBuilder<From, From, provider::Ctor<From>, Scope> {
+  constexpr auto in() && -> InBuilder<From, Unqualified<From>,
+                                      provider::Ctor<Unqualified<From>>,
+                                      Scope> {
     return {};
   }
 
   // Specify factory callable
   template <typename Factory>
-  constexpr auto via(Factory factory) && -> ViaBuilder<From, From, Factory> {
-    return ViaBuilder<From, From, Factory>{std::move(factory)};
+  constexpr auto via(Factory factory) && -> ViaBuilder<From, Unqualified<From>,
+                                                       Factory> {
+    return ViaBuilder<From, Unqualified<From>, Factory>{std::move(factory)};
   }
 
   // Default conversion: Transient<Ctor<From>>
-  constexpr
-  operator Binding<From, scope::Transient, provider::Ctor<From>>() && {
+  constexpr operator Binding<From, scope::Transient,
+                             provider::Ctor<Unqualified<From>>>() && {
     return {};
   }
 };
@@ -201,7 +216,7 @@ class InBuilder {
 
 template <typename From>
 Binding(BindBuilder<From>&&)
-    -> Binding<From, scope::Transient, provider::Ctor<From>>;
+    -> Binding<From, scope::Transient, provider::Ctor<Unqualified<From>>>;
 
 template <typename From, typename To>
 Binding(AsBuilder<From, To>&&)
@@ -236,6 +251,8 @@ Binding(InBuilder<From, To, Provider, Scope>&&)
 //     -> Transient<Factory<Implementation, decltype(factory)>>
 //   bind<Type>().in<scope::Singleton>() -> Singleton<Ctor<Type>>
 //   bind<Interface>().to(instance) -> Instance<decltype(instance)>
+//   bind<Type>().named<Qualifier>() -> Transient<Ctor<Type>>, keyed on
+//     NamedKey<Qualifier, Type>
 template <typename From>
 constexpr auto bind() -> BindBuilder<From> {
   return {};
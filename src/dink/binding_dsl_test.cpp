@@ -151,6 +151,32 @@ static_assert([]() constexpr {
       Binding<Instance, scope::Instance, provider::External<Instance>>>;
 }());
 
+// .named<Q>() keys on NamedKey<Q, From> and constructs From
+struct Qualifier {};
+using Qualified = NamedKey<Qualifier, Type>;
+
+static_assert(std::same_as<decltype(bind<Type>().named<Qualifier>()),
+                           BindBuilder<Qualified>>);
+static_assert(
+    std::same_as<decltype(Binding{bind<Type>().named<Qualifier>()}),
+                 Binding<Qualified, scope::Transient, provider::Ctor<Type>>>);
+static_assert(std::same_as<decltype(Binding{bind<Type>()
+                                                .named<Qualifier>()
+                                                .in<scope::Singleton>()}),
+                           Binding<Qualified, scope::Singleton,
+                                   provider::Ctor<Type>>>);
+static_assert(
+    std::same_as<
+        decltype(Binding{bind<Type>().named<Qualifier>().via(type_factory)}),
+        Binding<Qualified, scope::Transient,
+                provider::Factory<Type, TypeFactory>>>);
+static_assert(
+    std::same_as<decltype(Binding{bind<Interface>()
+                                      .named<Qualifier>()
+                                      .as<Implementation>()}),
+                 Binding<NamedKey<Qualifier, Interface>, scope::Transient,
+                         provider::Ctor<Implementation>>>);
+
 // ----------------------------------------------------------------------------
 // Exhaustive Binding Type Tests
 // ----------------------------------------------------------------------------
@@ -0,0 +1,58 @@
+/*!
+  \file
+  \brief Provides the per-instance cache.
+
+  This is opt-in, because it pulls <any>, <typeindex>, and <unordered_map> into
+  every translation unit that includes it.
+
+  \copyright Copyright (c) 2025 Frank Secilia \n
+  SPDX-License-Identifier: MIT
+*/
+
+#pragma once
+
+#include <dink/lib.hpp>
+#include <any>
+#include <typeindex>
+#include <unordered_map>
+
+namespace dink::cache {
+
+class Instance {
+ public:
+  template <typename Container, typename Provider>
+  auto get_or_create(Container& container, Provider& provider) ->
+      typename Provider::Provided& {
+    using Provided = typename Provider::Provided;
+
+    /*
+      This keys on *Provider*, not Provided, so it matches semantics with the
+      Meyers singleton in cache::Type.
+    */
+    const auto instance = map_.find(typeid(Provider));
+    if (instance != map_.end()) {
+      return *std::any_cast<Provided>(&instance->second);
+    }
+
+    return create(container, provider);
+  }
+
+ private:
+  std::unordered_map<std::type_index, std::any> map_;
+
+  //! Creates and caches the instance, outside of get_or_create's hot path.
+  template <typename Container, typename Provider>
+  [[dink_cold]] auto create(Container& container, Provider& provider) ->
+      typename Provider::Provided& {
+    using Provided = typename Provider::Provided;
+
+    auto& instance =
+        map_.try_emplace(typeid(Provider),
+                         provider.template create<Provided>(container))
+            .first->second;
+
+    return *std::any_cast<Provided>(&instance);
+  }
+};
+
+}  // namespace dink::cache
@@ -0,0 +1,53 @@
+/*!
+  \file
+  \brief Provides the per-type cache, the default for containers.
+
+  \copyright Copyright (c) 2025 Frank Secilia \n
+  SPDX-License-Identifier: MIT
+*/
+
+#pragma once
+
+#include <dink/lib.hpp>
+#include <concepts>
+
+namespace dink::cache {
+
+class Type {
+ public:
+  //! Gets the instance, creating it on first use.
+  //
+  // After the first call, this inlines to the static's guard check and a load.
+  // Construction, including the whole dependency graph behind it, is outlined
+  // into create(), which initializes the static directly through guaranteed
+  // copy elision.
+  //
+  // This only throws if construction does.
+  template <typename Container, typename Provider>
+  auto get_or_create(Container& container, Provider& provider) noexcept(
+      noexcept(provider.template create<typename Provider::Provided>(
+          container))) -> typename Provider::Provided& {
+    static auto instance = create(container, provider);
+
+    return instance;
+  }
+
+ private:
+  template <typename Container, typename Provider>
+  [[dink_cold]] static auto create(Container& container, Provider& provider)
+      noexcept(noexcept(provider.template create<typename Provider::Provided>(
+          container))) -> typename Provider::Provided {
+    using Provided = typename Provider::Provided;
+    return provider.template create<Provided>(container);
+  }
+};
+
+template <typename Cache, typename Container, typename Provider>
+concept IsCache =
+    requires(Cache& cache, Container& container, Provider& provider) {
+      {
+        cache.get_or_create(container, provider)
+      } -> std::same_as<typename Provider::Provided&>;
+    };
+
+}  // namespace dink::cache
@@ -7,8 +7,11 @@
 #pragma once
 
 #include <dink/lib.hpp>
-#include <functional>
+#include <dink/fwd.hpp>
+#include <concepts>
+#include <cstddef>
 #include <memory>
+#include <type_traits>
 
 namespace dink {
 namespace canonical::detail {
@@ -81,8 +84,12 @@ template <typename Source, std::size_t size>
 struct Canonical<const Source[size]> : Canonical<Source> {};
 
 //! Removes reference_wrapper.
+//
+// unwrap_reference recognizes reference_wrapper from <type_traits>, so this
+// header doesn't pull in all of <functional> to name it.
 template <typename Source>
-struct Canonical<std::reference_wrapper<Source>> : Canonical<Source> {};
+  requires(!std::same_as<std::unwrap_reference_t<Source>, Source>)
+struct Canonical<Source> : Canonical<std::unwrap_reference_t<Source>> {};
 
 //! Removes unique_ptr.
 template <typename Source, typename Deleter>
@@ -96,6 +103,11 @@ struct Canonical<std::shared_ptr<Source>> : Canonical<Source> {};
 template <typename Source>
 struct Canonical<std::weak_ptr<Source>> : Canonical<Source> {};
 
+//! Removes InlinePoly.
+template <typename Source, std::size_t capacity, std::size_t alignment>
+struct Canonical<InlinePoly<Source, capacity, alignment>> : Canonical<Source> {
+};
+
 }  // namespace canonical::detail
 
 //! Trait to remove all ref, cv, and pointer qualifiers and standard wrappers.
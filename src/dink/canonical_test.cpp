@@ -4,6 +4,7 @@
 
 #include "canonical.hpp"
 #include <dink/test.hpp>
+#include <functional>
 
 namespace dink {
 namespace {
@@ -70,6 +71,7 @@ static_assert(std::is_same_v<Canonical<std::unique_ptr<Type>>, Type>);
 static_assert(std::is_same_v<Canonical<std::unique_ptr<Type, Deleter>>, Type>);
 static_assert(std::is_same_v<Canonical<std::shared_ptr<Type>>, Type>);
 static_assert(std::is_same_v<Canonical<std::weak_ptr<Type>>, Type>);
+static_assert(std::is_same_v<Canonical<InlinePoly<Type, 16>>, Type>);
 
 // Type combinations.
 // ----------------------------------------------------------------------------
@@ -0,0 +1,261 @@
+#!/usr/bin/env python3
+# copyright (c) 2025 Frank Secilia
+# SPDX-License-Identifier: MIT
+
+"""Generates synthetic translation units that stress dink at compile time.
+
+Each kind of benchmark varies one dimension of the object graph by size:
+
+  bindings   number of bindings in one container; a fixed sample of them is
+             resolved, so lookup cost is isolated from the number of lookups
+  arity      constructor or factory arity of a fixed number of resolved
+             types, up to dink_max_deduced_arity
+  depth      length of a dependency chain resolved from its last link
+  hierarchy  number of nested containers a request is delegated through
+  shapes     number of singletons, each requested as T&, const T&, T*,
+             const T*, shared_ptr<T>, and weak_ptr<T>
+  sites      number of services, each resolved from many call sites, as a
+             sample program for size_report.py
+
+With --module, the benchmark imports the dink module instead of including
+dink's headers, so the two can be compared.
+
+usage: generate.py [--module] <kind> <size> <output.cpp>
+"""
+
+import sys
+
+NUM_RESOLVED = 100
+NUM_CONSUMERS = 50
+NUM_SITES = 20
+
+
+def header(kind: str, size: int, module: bool) -> list[str]:
+    if module:
+        return [
+            f"// generated by generate.py --module {kind} {size}",
+            "",
+            "import dink;",
+            "",
+            "namespace dink::compile_bench {",
+            "",
+        ]
+    return [
+        f"// generated by generate.py {kind} {size}",
+        "",
+        "#include <dink/binding_dsl.hpp>",
+        "#include <dink/container.hpp>",
+        "",
+        "namespace dink::compile_bench {",
+        "",
+    ]
+
+
+def footer() -> list[str]:
+    return ["}", "", "}  // namespace dink::compile_bench", ""]
+
+
+def generate_bindings(num_bindings: int) -> list[str]:
+    num_resolved = min(NUM_RESOLVED, num_bindings)
+    resolved = [
+        (sample + 1) * num_bindings // num_resolved - 1
+        for sample in range(num_resolved)
+    ]
+
+    lines = [f"struct Type{index} {{}};" for index in range(num_bindings)]
+    lines += ["", "auto run() -> void {", "  auto container = Container{"]
+    lines += [f"      bind<Type{index}>()," for index in range(num_bindings)]
+    lines += ["  };", ""]
+    lines += [
+        f"  [[maybe_unused]] auto type{index} = "
+        f"container.resolve<Type{index}>();"
+        for index in resolved
+    ]
+    return lines
+
+
+def generate_arity(arity: int) -> list[str]:
+    lines = [f"struct Dependency{index} {{}};" for index in range(arity)]
+    params = ", ".join(f"Dependency{index}" for index in range(arity))
+    for consumer in range(NUM_CONSUMERS):
+        lines += [
+            "",
+            f"struct Consumer{consumer} {{",
+            f"  explicit Consumer{consumer}({params}) {{}}",
+            "};",
+        ]
+
+    # Half of the consumers are produced by factories, half by constructors.
+    factories = range(0, NUM_CONSUMERS, 2)
+    for consumer in factories:
+        lines += [
+            "",
+            f"struct MakeConsumer{consumer} {{",
+            f"  auto operator()({params}) const -> Consumer{consumer};",
+            "};",
+        ]
+    lines += ["", "auto run() -> void {", "  auto container = Container{"]
+    lines += [
+        f"      bind<Consumer{consumer}>().via(MakeConsumer{consumer}{{}}),"
+        for consumer in factories
+    ]
+    lines += ["  };"]
+    lines += [
+        f"  [[maybe_unused]] auto consumer{consumer} = "
+        f"container.resolve<Consumer{consumer}>();"
+        for consumer in range(NUM_CONSUMERS)
+    ]
+    return lines
+
+
+def generate_depth(depth: int) -> list[str]:
+    lines = ["struct Link0 {};"]
+    for link in range(1, depth):
+        lines += [
+            "",
+            f"struct Link{link} {{",
+            f"  explicit Link{link}(Link{link - 1}&) {{}}",
+            "};",
+        ]
+    lines += ["", "auto run() -> void {", "  auto container = Container{"]
+    lines += [
+        f"      bind<Link{link}>().in<scope::Singleton>(),"
+        for link in range(depth)
+    ]
+    lines += [
+        "  };",
+        "",
+        f"  [[maybe_unused]] auto& link = container.resolve<Link{depth - 1}&>();",
+    ]
+    return lines
+
+
+def generate_hierarchy(num_levels: int) -> list[str]:
+    lines = [f"struct Local{level} {{}};" for level in range(num_levels)]
+    lines += [
+        "",
+        "struct Root {};",
+        "",
+        "auto run() -> void {",
+        "  auto container0 = Container{",
+        "      bind<Root>().in<scope::Singleton>(),",
+        "      bind<Local0>(),",
+        "  };",
+    ]
+    for level in range(1, num_levels):
+        lines.append(
+            f"  auto container{level} = "
+            f"Container{{container{level - 1}, bind<Local{level}>()}};"
+        )
+    leaf = f"container{num_levels - 1}"
+    lines += [
+        "",
+        f"  [[maybe_unused]] auto& root = {leaf}.resolve<Root&>();",
+        f"  [[maybe_unused]] auto local = {leaf}.resolve<Local0>();",
+    ]
+    return lines
+
+
+def generate_shapes(num_types: int) -> list[str]:
+    lines = []
+    for index in range(num_types):
+        lines += [
+            f"struct Type{index} {{}};",
+            "",
+            f"struct Consumer{index} {{",
+            f"  Consumer{index}(Type{index}&, const Type{index}&, "
+            f"Type{index}*, const Type{index}*,",
+            f"            std::shared_ptr<Type{index}>, "
+            f"std::weak_ptr<Type{index}>) {{}}",
+            "};",
+            "",
+        ]
+    lines += ["auto run() -> void {", "  auto container = Container{"]
+    lines += [
+        f"      bind<Type{index}>().in<scope::Singleton>(),"
+        for index in range(num_types)
+    ]
+    lines += ["  };", ""]
+    lines += [
+        f"  [[maybe_unused]] auto consumer{index} = "
+        f"container.resolve<Consumer{index}>();"
+        for index in range(num_types)
+    ]
+    return lines
+
+
+def generate_sites(num_services: int) -> list[str]:
+    lines = [
+        "struct Logger {",
+        "  int_t value = 1;",
+        "  Logger() = default;",
+        "};",
+        "",
+    ]
+    for index in range(num_services):
+        lines += [
+            f"struct Repository{index} {{",
+            "  int_t value;",
+            f"  explicit Repository{index}(Logger& logger)",
+            f"      : value{{logger.value + {index}}} {{}}",
+            "};",
+            "",
+            f"struct Service{index} {{",
+            "  int_t value;",
+            f"  Service{index}(Repository{index}& repository, Logger& logger)",
+            "      : value{repository.value + logger.value} {}",
+            "};",
+            "",
+        ]
+    for site in range(NUM_SITES):
+        lines += [f"auto site{site}(Container<>& container) -> int_t {{"]
+        lines += ["  auto result = int_t{};"]
+        lines += [
+            f"  result += container.resolve<Service{index}>().value;"
+            for index in range(num_services)
+        ]
+        lines += [f"  return result + {site};", "}", ""]
+    lines += ["auto run() -> int_t {", "  auto container = Container<>{};"]
+    lines += ["  auto result = int_t{};"]
+    lines += [f"  result += site{site}(container);" for site in range(NUM_SITES)]
+    lines += ["  return result;"]
+    return lines
+
+
+GENERATORS = {
+    "bindings": generate_bindings,
+    "arity": generate_arity,
+    "depth": generate_depth,
+    "hierarchy": generate_hierarchy,
+    "shapes": generate_shapes,
+    "sites": generate_sites,
+}
+
+
+def generate(kind: str, size: int, module: bool) -> str:
+    return "\n".join(
+        header(kind, size, module) + GENERATORS[kind](size) + footer()
+    )
+
+
+def main() -> int:
+    args = sys.argv[1:]
+    module = bool(args) and args[0] == "--module"
+    if module:
+        args = args[1:]
+    if len(args) != 3 or args[0] not in GENERATORS:
+        print(__doc__.strip().splitlines()[-1], file=sys.stderr)
+        return 1
+
+    kind, size, output_path = args[0], int(args[1]), args[2]
+    if size < 1:
+        print(f"size must be positive: {size}", file=sys.stderr)
+        return 1
+
+    with open(output_path, "w", encoding="utf-8") as output:
+        output.write(generate(kind, size, module))
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
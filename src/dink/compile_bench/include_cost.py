@@ -0,0 +1,117 @@
+#!/usr/bin/env python3
+# copyright (c) 2025 Frank Secilia
+# SPDX-License-Identifier: MIT
+
+"""Measures the cost of including each dink header on its own.
+
+For each header, this compiles a translation unit containing only its include,
+and records the preprocessed size in lines and bytes, and the parse time, as
+the fastest of several -fsyntax-only runs. This isolates what a header drags
+into every translation unit that includes it, apart from any instantiation.
+
+To compare before and after a change, save the results of a run on the old
+tree and pass them as --baseline on the new one. Headers in both are compared
+on stdout.
+
+usage: include_cost.py --compiler <cxx> --output <results.json>
+                       [--flag <flag>]... [--repeat <n>]
+                       [--baseline <results.json>] <header>...
+"""
+
+import argparse
+import json
+import platform
+import subprocess
+import sys
+import time
+
+
+def compiler_version(compiler: str) -> str:
+    result = subprocess.run(
+        [compiler, "--version"], capture_output=True, text=True, check=True
+    )
+    return result.stdout.splitlines()[0]
+
+
+def run_on_include(command: list[str], header: str) -> subprocess.CompletedProcess:
+    source = f"#include <dink/{header}>\n"
+    result = subprocess.run(
+        [*command, "-x", "c++", "-"], input=source, capture_output=True,
+        text=True,
+    )
+    if result.returncode != 0:
+        print(result.stderr, file=sys.stderr)
+        raise RuntimeError(f"failed to compile {header}")
+    return result
+
+
+def measure(header: str, compiler: str, flags: list[str], repeat: int) -> dict:
+    preprocessed = run_on_include([compiler, *flags, "-E", "-P"], header).stdout
+
+    parse_times = []
+    for _ in range(repeat):
+        start = time.perf_counter()
+        run_on_include([compiler, *flags, "-fsyntax-only"], header)
+        parse_times.append(time.perf_counter() - start)
+
+    return {
+        "name": header,
+        "preprocessed_lines": preprocessed.count("\n"),
+        "preprocessed_bytes": len(preprocessed.encode()),
+        "parse_time_s": round(min(parse_times), 3),
+    }
+
+
+def print_comparison(results: list[dict], baseline: list[dict]) -> None:
+    """Prints size and parse time against the baseline for shared headers."""
+    before_by_name = {result["name"]: result for result in baseline}
+    for after in results:
+        before = before_by_name.get(after["name"])
+        if not before:
+            continue
+        print(
+            f"include_cost: {after['name']}: "
+            f"lines {before['preprocessed_lines']} -> "
+            f"{after['preprocessed_lines']}, "
+            f"parse {before['parse_time_s']:.3f}s -> "
+            f"{after['parse_time_s']:.3f}s"
+        )
+
+
+def main() -> int:
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument("--compiler", required=True)
+    parser.add_argument("--output", required=True)
+    parser.add_argument("--flag", action="append", default=[], dest="flags")
+    parser.add_argument("--repeat", type=int, default=5)
+    parser.add_argument("--baseline")
+    parser.add_argument("headers", nargs="+")
+    args = parser.parse_args()
+
+    results = []
+    for header in args.headers:
+        print(f"include_cost: {header}", flush=True)
+        results.append(
+            measure(header, args.compiler, args.flags, args.repeat)
+        )
+
+    if args.baseline:
+        with open(args.baseline, encoding="utf-8") as baseline:
+            print_comparison(results, json.load(baseline)["headers"])
+
+    report = {
+        "timestamp": time.strftime("%Y-%m-%dT%H:%M:%SZ", time.gmtime()),
+        "host": platform.node(),
+        "compiler": args.compiler,
+        "compiler_version": compiler_version(args.compiler),
+        "flags": args.flags,
+        "headers": results,
+    }
+    with open(args.output, "w", encoding="utf-8") as output:
+        json.dump(report, output, indent=2)
+        output.write("\n")
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -0,0 +1,248 @@
+#!/usr/bin/env python3
+# copyright (c) 2025 Frank Secilia
+# SPDX-License-Identifier: MIT
+
+"""Compiles generated benchmarks one at a time and records their cost as JSON.
+
+For each source, this records wall time, the compiler's peak RSS, and a
+summary of where the compiler spent its time. Clang's summary comes from
+-ftime-trace, using its "Total ..." events. GCC has no -ftime-trace, so its
+summary comes from the phases reported by -ftime-report instead.
+
+Sources are named <kind>_<size>.cpp, as generated by generate.py, or
+<kind>_<size>_module.cpp when generated with --module. Module sources require
+--module-interface. The interface is precompiled once, and its cost is
+recorded separately, so each module source is measured as a consumer of an
+already-built module. When both forms of a benchmark are given, their wall
+times are compared on stdout.
+
+usage: run.py --compiler <cxx> --output <results.json> [--flag <flag>]...
+              [--module-interface <dink.cppm>] <source>...
+"""
+
+import argparse
+import json
+import os
+import pathlib
+import platform
+import re
+import subprocess
+import sys
+import tempfile
+import time
+
+# Matches a benchmark source's stem: kind, size, and optional module suffix.
+SOURCE_STEM = re.compile(r"^(?P<kind>\w+?)_(?P<size>\d+)(?P<module>_module)?$")
+
+# Matches a line of -ftime-report: name, then usr, sys, and wall columns.
+# The TOTAL line has no percentages.
+TIME_REPORT_LINE = re.compile(
+    r"^\s*(?P<name>[^:]+?)\s*:"
+    r"\s*[\d.]+\s*(?:\(\s*\d+%\))?"
+    r"\s*[\d.]+\s*(?:\(\s*\d+%\))?"
+    r"\s*(?P<wall>[\d.]+)"
+)
+
+
+def compiler_version(compiler: str) -> str:
+    result = subprocess.run(
+        [compiler, "--version"], capture_output=True, text=True, check=True
+    )
+    return result.stdout.splitlines()[0]
+
+
+def is_clang(version: str) -> bool:
+    return "clang" in version.lower()
+
+
+def run_compiler(command: list[str]) -> tuple[int, float, int | None, str]:
+    """Runs command, returning status, wall time, peak RSS in KiB, stderr."""
+    start = time.perf_counter()
+    with tempfile.TemporaryFile(mode="w+") as stderr:
+        process = subprocess.Popen(command, stderr=stderr)
+        if hasattr(os, "wait4"):
+            _, status, usage = os.wait4(process.pid, 0)
+            process.returncode = os.waitstatus_to_exitcode(status)
+            peak_rss_kib = usage.ru_maxrss
+            if sys.platform == "darwin":
+                peak_rss_kib //= 1024  # macOS reports bytes.
+        else:
+            process.wait()
+            peak_rss_kib = None
+        wall_time = time.perf_counter() - start
+        stderr.seek(0)
+        return process.returncode, wall_time, peak_rss_kib, stderr.read()
+
+
+def summarize_time_trace(trace_path: pathlib.Path) -> dict[str, float]:
+    """Sums clang's "Total ..." events, in seconds."""
+    with open(trace_path, encoding="utf-8") as trace_file:
+        events = json.load(trace_file)["traceEvents"]
+    return {
+        event["name"].removeprefix("Total "): event["dur"] / 1e6
+        for event in events
+        if event.get("name", "").startswith("Total ")
+    }
+
+
+def summarize_time_report(report: str) -> dict[str, float]:
+    """Collects GCC's phase and total wall times, in seconds."""
+    summary = {}
+    for line in report.splitlines():
+        match = TIME_REPORT_LINE.match(line)
+        if not match:
+            continue
+        name = match["name"]
+        if name.startswith("phase ") or name == "TOTAL":
+            summary[name] = float(match["wall"])
+    return summary
+
+
+def build_module_interface(
+    interface: pathlib.Path,
+    compiler: str,
+    flags: list[str],
+    clang: bool,
+    work_dir: pathlib.Path,
+) -> tuple[list[str], dict]:
+    """Precompiles the module interface.
+
+    Returns the flags consumers need to import it, and its measured cost.
+    """
+    if clang:
+        bmi_path = work_dir / "dink.pcm"
+        command = [compiler, *flags, "--precompile", "-x", "c++-module"]
+        command += [str(interface), "-o", str(bmi_path)]
+        consumer_flags = [f"-fmodule-file=dink={bmi_path}"]
+    else:
+        mapper_path = work_dir / "dink.mapper"
+        mapper_path.write_text(f"dink {work_dir / 'dink.gcm'}\n")
+        consumer_flags = ["-fmodules-ts", f"-fmodule-mapper={mapper_path}"]
+        command = [compiler, *flags, *consumer_flags, "-x", "c++"]
+        command += [str(interface), "-c", "-o", str(work_dir / "dink.o")]
+
+    status, wall_time, peak_rss_kib, stderr = run_compiler(command)
+    if status != 0:
+        print(stderr, file=sys.stderr)
+        raise RuntimeError(f"failed to compile {interface}")
+
+    return consumer_flags, {
+        "name": interface.name,
+        "wall_time_s": round(wall_time, 3),
+        "peak_rss_kib": peak_rss_kib,
+    }
+
+
+def run_benchmark(
+    source: pathlib.Path,
+    compiler: str,
+    flags: list[str],
+    clang: bool,
+    work_dir: pathlib.Path,
+) -> dict:
+    stem = SOURCE_STEM.match(source.stem)
+    if not stem:
+        raise RuntimeError(f"unexpected benchmark name: {source}")
+    object_path = work_dir / f"{source.stem}.o"
+    trace_flag = "-ftime-trace" if clang else "-ftime-report"
+    command = [compiler, *flags, trace_flag, "-c", str(source)]
+    command += ["-o", str(object_path)]
+
+    status, wall_time, peak_rss_kib, stderr = run_compiler(command)
+    if status != 0:
+        print(stderr, file=sys.stderr)
+        raise RuntimeError(f"failed to compile {source}")
+
+    if clang:
+        summary = summarize_time_trace(object_path.with_suffix(".json"))
+    else:
+        summary = summarize_time_report(stderr)
+
+    return {
+        "name": source.stem,
+        "kind": stem["kind"],
+        "size": int(stem["size"]),
+        "form": "module" if stem["module"] else "header",
+        "wall_time_s": round(wall_time, 3),
+        "peak_rss_kib": peak_rss_kib,
+        "time_trace": {
+            "source": trace_flag,
+            "seconds": {
+                name: round(seconds, 3) for name, seconds in summary.items()
+            },
+        },
+    }
+
+
+def print_comparison(results: list[dict]) -> None:
+    """Prints header and module wall times for benchmarks run both ways."""
+    by_form = {
+        (result["kind"], result["size"], result["form"]): result
+        for result in results
+    }
+    for (kind, size, form), header in by_form.items():
+        module = by_form.get((kind, size, "module"))
+        if form != "header" or not module:
+            continue
+        print(
+            f"compile_bench: {kind}_{size}: "
+            f"header {header['wall_time_s']:.3f}s, "
+            f"module {module['wall_time_s']:.3f}s, "
+            f"{header['wall_time_s'] / module['wall_time_s']:.2f}x"
+        )
+
+
+def main() -> int:
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument("--compiler", required=True)
+    parser.add_argument("--output", required=True, type=pathlib.Path)
+    parser.add_argument("--flag", action="append", default=[], dest="flags")
+    parser.add_argument("--module-interface", type=pathlib.Path)
+    parser.add_argument("sources", nargs="+", type=pathlib.Path)
+    args = parser.parse_args()
+
+    version = compiler_version(args.compiler)
+    clang = is_clang(version)
+
+    results = []
+    module_interface = None
+    with tempfile.TemporaryDirectory() as work_dir:
+        work_dir = pathlib.Path(work_dir)
+        module_flags = []
+        if args.module_interface:
+            print(f"compile_bench: {args.module_interface.name}", flush=True)
+            module_flags, module_interface = build_module_interface(
+                args.module_interface, args.compiler, args.flags, clang,
+                work_dir,
+            )
+
+        for source in args.sources:
+            print(f"compile_bench: {source.stem}", flush=True)
+            is_module = source.stem.endswith("_module")
+            if is_module and not args.module_interface:
+                raise RuntimeError(f"{source} requires --module-interface")
+            flags = [*args.flags, *module_flags] if is_module else args.flags
+            results.append(
+                run_benchmark(source, args.compiler, flags, clang, work_dir)
+            )
+
+    print_comparison(results)
+
+    report = {
+        "timestamp": time.strftime("%Y-%m-%dT%H:%M:%SZ", time.gmtime()),
+        "host": platform.node(),
+        "compiler": args.compiler,
+        "compiler_version": version,
+        "flags": args.flags,
+        "module_interface": module_interface,
+        "benchmarks": results,
+    }
+    args.output.parent.mkdir(parents=True, exist_ok=True)
+    with open(args.output, "w", encoding="utf-8") as output:
+        json.dump(report, output, indent=2)
+        output.write("\n")
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
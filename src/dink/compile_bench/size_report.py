@@ -0,0 +1,198 @@
+#!/usr/bin/env python3
+# copyright (c) 2025 Frank Secilia
+# SPDX-License-Identifier: MIT
+
+"""Attributes the .text of a sample program to the types it resolves.
+
+This compiles a source, usually one generated by `generate.py sites`, once
+with resolution inlined and once with -Ddink_outline_resolution=1, then
+attributes each byte of its code to a name from the sample's namespace.
+
+Attribution uses the debug info's inline chain for each instruction, so code
+inlined into a call site counts toward what it resolves rather than toward the
+site. An instruction is attributed to the type requested by the innermost
+Container::resolve() it was inlined from, or if there is none, to the first
+name from the namespace that any of its enclosing functions mentions,
+outermost first. Both builds therefore attribute a resolution's code to the
+same type, whether it was emitted in a thunk or inlined into each caller. Code
+that mentions no such name is grouped as "(other)".
+
+The objects are compiled with -g added, which does not change the code
+generated. Totals include alignment padding between functions.
+
+Per-name sizes for both builds are printed on stdout, largest first, and
+written to the output as json.
+
+usage: size_report.py --compiler <cxx> --output <results.json>
+                      [--flag <flag>]... [--namespace <ns>] [--top <n>]
+                      <source>
+"""
+
+import argparse
+import collections
+import json
+import os
+import platform
+import re
+import subprocess
+import sys
+import tempfile
+import time
+
+CONFIGURATIONS = {
+    "inlined": [],
+    "outlined": ["-Ddink_outline_resolution=1"],
+}
+
+INSTRUCTION = re.compile(r"^\s*([0-9a-f]+):\t((?:[0-9a-f]{2} )+)")
+SECTION = re.compile(r"^Disassembly of section (\S+):$")
+RESOLVE = "::resolve<"
+
+
+def compiler_version(compiler: str) -> str:
+    result = subprocess.run(
+        [compiler, "--version"], capture_output=True, text=True, check=True
+    )
+    return result.stdout.splitlines()[0]
+
+
+def compile_object(compiler: str, flags: list[str], source: str,
+                   output: str) -> None:
+    result = subprocess.run(
+        [compiler, *flags, "-g", "-c", source, "-o", output],
+        capture_output=True, text=True,
+    )
+    if result.returncode != 0:
+        print(result.stderr, file=sys.stderr)
+        raise RuntimeError(f"failed to compile {source}")
+
+
+def code_bytes(path: str) -> dict[str, list[tuple[int, int]]]:
+    """Returns the address and size of each line of code, by section."""
+    result = subprocess.run(
+        ["objdump", "--disassemble", "--wide", path],
+        capture_output=True, text=True, check=True,
+    )
+    sections = collections.defaultdict(list)
+    section = None
+    for line in result.stdout.splitlines():
+        if match := SECTION.match(line):
+            section = match.group(1)
+        elif section and (match := INSTRUCTION.match(line)):
+            size = len(match.group(2).split())
+            sections[section].append((int(match.group(1), 16), size))
+    return sections
+
+
+def inline_chains(path: str, section: str,
+                  addresses: list[int]) -> list[list[str]]:
+    """Returns the functions each address was inlined from, innermost first."""
+    result = subprocess.run(
+        ["addr2line", "--addresses", "--functions", "--inlines", "--demangle",
+         "--section", section, "--exe", path],
+        input="".join(f"{address:#x}\n" for address in addresses),
+        capture_output=True, text=True, check=True,
+    )
+    # Each address is followed by a function and location line per frame.
+    chains = []
+    for line in result.stdout.splitlines():
+        if line.startswith("0x"):
+            chains.append([])
+        else:
+            chains[-1].append(line)
+    return [lines[::2] for lines in chains]
+
+
+def owner(chain: list[str], pattern: re.Pattern) -> str:
+    """Chooses the name an instruction with this inline chain counts toward."""
+    for function in chain:
+        if "dink::Container<" in function and RESOLVE in function:
+            requested = function[function.rindex(RESOLVE):]
+            if match := pattern.search(requested):
+                return match.group(1)
+    for function in reversed(chain):
+        if match := pattern.search(function):
+            return match.group(1)
+    return "(other)"
+
+
+def attribute(path: str, namespace: str) -> dict:
+    """Sums code sizes by the name from namespace each byte counts toward."""
+    pattern = re.compile(re.escape(namespace + "::") + r"(\w+)")
+    sizes = collections.Counter()
+    for section, lines in code_bytes(path).items():
+        addresses = [address for address, _ in lines]
+        chains = inline_chains(path, section, addresses)
+        for (_, size), chain in zip(lines, chains, strict=True):
+            sizes[owner(chain, pattern)] += size
+    return dict(sizes)
+
+
+def measure(compiler: str, flags: list[str], source: str,
+            namespace: str) -> dict:
+    results = {}
+    with tempfile.TemporaryDirectory() as scratch:
+        for configuration, defines in CONFIGURATIONS.items():
+            output = os.path.join(scratch, f"{configuration}.o")
+            compile_object(compiler, [*flags, *defines], source, output)
+            sizes = attribute(output, namespace)
+            results[configuration] = {
+                "text_bytes": sum(sizes.values()),
+                "by_name": sizes,
+            }
+    return results
+
+
+def print_report(results: dict, top: int) -> None:
+    inlined = results["inlined"]
+    outlined = results["outlined"]
+    print(
+        f"size_report: total .text {inlined['text_bytes']} -> "
+        f"{outlined['text_bytes']} bytes"
+    )
+
+    names = set(inlined["by_name"]) | set(outlined["by_name"])
+    largest = sorted(
+        names,
+        key=lambda name: max(
+            inlined["by_name"].get(name, 0), outlined["by_name"].get(name, 0)
+        ),
+        reverse=True,
+    )
+    for name in largest[:top]:
+        print(
+            f"size_report: {name}: {inlined['by_name'].get(name, 0)} -> "
+            f"{outlined['by_name'].get(name, 0)} bytes"
+        )
+
+
+def main() -> int:
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument("--compiler", required=True)
+    parser.add_argument("--output", required=True)
+    parser.add_argument("--flag", action="append", default=[], dest="flags")
+    parser.add_argument("--namespace", default="dink::compile_bench")
+    parser.add_argument("--top", type=int, default=20)
+    parser.add_argument("source")
+    args = parser.parse_args()
+
+    results = measure(args.compiler, args.flags, args.source, args.namespace)
+    print_report(results, args.top)
+
+    report = {
+        "timestamp": time.strftime("%Y-%m-%dT%H:%M:%SZ", time.gmtime()),
+        "host": platform.node(),
+        "compiler": args.compiler,
+        "compiler_version": compiler_version(args.compiler),
+        "flags": args.flags,
+        "source": args.source,
+        "configurations": results,
+    }
+    with open(args.output, "w", encoding="utf-8") as output:
+        json.dump(report, output, indent=2)
+        output.write("\n")
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -12,6 +12,8 @@
 #include <dink/binding.hpp>
 #include <dink/meta.hpp>
 #include <dink/scope.hpp>
+#include <array>
+#include <concepts>
 #include <tuple>
 #include <utility>
 
@@ -22,43 +24,165 @@ class Config;
 
 namespace detail {
 
+// ----------------------------------------------------------------------------
+// BindingKeys
+// ----------------------------------------------------------------------------
+
+//! Unique address per type, comparable in constant expressions.
+template <typename Type>
+inline constexpr auto type_key = char{};
+
+//! Maps a binding's FromType to its index, as a base of BindingKeyMap.
+template <typename From, std::size_t index>
+struct KeyedIndex {};
+
+//! Overload set mapping each FromType to its index.
+template <typename IndexSequence, typename... FromTypes>
+struct BindingKeyMap;
+
+template <std::size_t... indices, typename... FromTypes>
+struct BindingKeyMap<std::index_sequence<indices...>, FromTypes...>
+    : KeyedIndex<FromTypes, indices>... {};
+
+//! Deduces the index of the only base keyed on From.
+//
+// Deduction fails if From is not bound, or is bound more than once.
+template <typename From, std::size_t index>
+constexpr auto keyed_index(const KeyedIndex<From, index>*) noexcept
+    -> std::size_t {
+  return index;
+}
+
+//! Lookup structures for a bindings tuple.
+//
+// These are computed once per bindings tuple. Lookups then resolve an
+// overload against the key map, or scan the keys in a constant expression.
+// Neither recurses over the bindings or instantiates anything per binding,
+// so each lookup is a single instantiation, regardless of the number of
+// bindings.
+//
+// \tparam BindingsTuple tuple of binding types
+template <typename BindingsTuple>
+struct BindingKeys;
+
+template <typename... Bindings>
+struct BindingKeys<std::tuple<Bindings...>> {
+  using Map = BindingKeyMap<std::index_sequence_for<Bindings...>,
+                            typename Bindings::FromType...>;
+
+  static constexpr auto kSize = sizeof...(Bindings);
+
+  // The trailing nullptr keeps the array nonempty.
+  static constexpr const char* kKeys[] = {
+      &type_key<typename Bindings::FromType>..., nullptr};
+};
+
 // ----------------------------------------------------------------------------
 // BindingIndex
 // ----------------------------------------------------------------------------
 
 inline static constexpr auto npos = std::size_t(-1);
 
-//! Finds the index of a binding for Resolved in the bindings tuple.
+//! Finds the index of the first binding for From in the bindings tuple.
 //
-// \tparam Resolved type to search for
-// \tparam index current search index
+// \tparam From type to search for
 // \tparam BindingsTuple tuple of binding types
 // \return index of binding, or npos if not found
-template <typename From, std::size_t index, typename BindingsTuple>
-struct BindingIndex;
-
-//! Base case: value was not found.
-template <typename From, std::size_t index, typename BindingsTuple>
+template <typename From, typename BindingsTuple>
 struct BindingIndex {
-  static constexpr auto value = npos;
-};
+  using Keys = BindingKeys<BindingsTuple>;
 
-//! Recursive case: check if current binding matches, otherwise continue.
-template <typename From, std::size_t index, typename BindingsTuple>
-  requires(index < std::tuple_size_v<BindingsTuple>)
-struct BindingIndex<From, index, BindingsTuple> {
-  using CurrentBinding = std::tuple_element_t<index, BindingsTuple>;
-
-  static constexpr auto value =
-      std::same_as<From, typename CurrentBinding::FromType>
-          ? index
-          : BindingIndex<From, index + 1, BindingsTuple>::value;
+  static constexpr auto value = [] {
+    using Map = typename Keys::Map;
+    if constexpr (requires(const Map* map) { keyed_index<From>(map); }) {
+      return keyed_index<From>(static_cast<const Map*>(nullptr));
+    } else {
+      for (auto index = std::size_t{}; index < Keys::kSize; ++index) {
+        if (Keys::kKeys[index] == &type_key<From>) return index;
+      }
+      return npos;
+    }
+  }();
 };
 
 //! Variable template containing binding index.
 template <typename From, typename BindingsTuple>
 inline static constexpr auto binding_index =
-    BindingIndex<From, 0, BindingsTuple>::value;
+    BindingIndex<From, BindingsTuple>::value;
+
+// ----------------------------------------------------------------------------
+// BindingIndices
+// ----------------------------------------------------------------------------
+
+//! Finds the indices of every binding for From in the bindings tuple.
+//
+// \tparam From type to search for
+// \tparam BindingsTuple tuple of binding types
+// \return index_sequence of matching indices, in binding order
+template <typename From, typename BindingsTuple>
+struct BindingIndices {
+  using Keys = BindingKeys<BindingsTuple>;
+
+  static constexpr auto kCount = [] {
+    auto count = std::size_t{};
+    for (auto index = std::size_t{}; index < Keys::kSize; ++index) {
+      count += Keys::kKeys[index] == &type_key<From>;
+    }
+    return count;
+  }();
+
+  static constexpr auto kIndices = [] {
+    auto result = std::array<std::size_t, kCount>{};
+    auto count = std::size_t{};
+    for (auto index = std::size_t{}; index < Keys::kSize; ++index) {
+      if (Keys::kKeys[index] == &type_key<From>) result[count++] = index;
+    }
+    return result;
+  }();
+
+  using Type = decltype([]<std::size_t... matches>(
+                            std::index_sequence<matches...>) {
+    return std::index_sequence<kIndices[matches]...>{};
+  }(std::make_index_sequence<kCount>{}));
+};
+
+//! Variable template containing binding indices.
+template <typename From, typename BindingsTuple>
+inline static constexpr auto binding_indices =
+    typename BindingIndices<From, BindingsTuple>::Type{};
+
+// ----------------------------------------------------------------------------
+// BindingStorage
+// ----------------------------------------------------------------------------
+
+//! Binding stored as a base of BindingStorage, tagged by its index.
+template <std::size_t index, typename Binding>
+struct IndexedBinding {
+  [[dink_no_unique_address]] Binding binding;
+};
+
+//! Flat storage for a pack of bindings.
+//
+// std::tuple nests one level per element, which exceeds the default template
+// depth well before a thousand bindings. This inherits every binding
+// directly instead, so its depth is constant. It is an aggregate, so it is
+// initialized base by base, in order, without looking up each base by name.
+template <typename IndexSequence, typename... Bindings>
+struct BindingStorage;
+
+template <std::size_t... indices, typename... Bindings>
+struct BindingStorage<std::index_sequence<indices...>, Bindings...>
+    : IndexedBinding<indices, Bindings>... {};
+
+//! Gets the binding at index from BindingStorage.
+//
+// The binding is found by overload resolution against the storage's bases,
+// which deduces its type without recursing through the preceding bindings.
+template <std::size_t index, typename Binding>
+constexpr auto get(IndexedBinding<index, Binding>& indexed_binding) noexcept
+    -> Binding& {
+  return indexed_binding.binding;
+}
 
 }  // namespace detail
 
@@ -68,8 +192,8 @@ inline static constexpr auto binding_index =
 
 //! Searchable, type-safe, heterogeneous storage for DI bindings.
 //
-// This type stores bindings in a tuple, enabling O(1) lookup by resolved type
-// at compile time.
+// This type stores bindings in flat storage, enabling O(1) lookup by resolved
+// type at compile time.
 //
 // Each binding is a unique type mapping from a requested type (FromType) to:
 // - The type to construct (ToType)
@@ -83,15 +207,23 @@ class Config {
   using BindingsTuple = std::tuple<Bindings...>;
 
   //! Construct from a tuple of bindings.
-  explicit constexpr Config(BindingsTuple bindings) noexcept
-      : bindings_{std::move(bindings)} {}
+  //
+  // This is a template so copies and moves of Config do not consider it, which
+  // would instantiate BindingsTuple.
+  template <std::same_as<BindingsTuple> Tuple>
+  explicit constexpr Config(Tuple bindings) noexcept
+      : bindings_{std::apply(
+            [](auto&&... bindings) {
+              return Storage{{std::forward<decltype(bindings)>(bindings)}...};
+            },
+            std::move(bindings))} {}
 
   //! Construct from individual binding arguments.
   //
   // This constructor accepts types convertible to a binding and converts each.
   template <IsConvertibleToBinding... Args>
   explicit constexpr Config(Args&&... args) noexcept
-      : Config{std::tuple{Binding{std::forward<Args>(args)}...}} {}
+      : bindings_{{Binding{std::forward<Args>(args)}}...} {}
 
   //! Finds first binding with matching From type.
   //
@@ -109,20 +241,42 @@ class Config {
     constexpr auto index = detail::binding_index<From, BindingsTuple>;
 
     if constexpr (index != detail::npos) {
-      return &std::get<index>(bindings_);
+      return &detail::get<index>(bindings_);
     } else {
       return nullptr;
     }
   }
 
+  //! Finds every binding with matching From type.
+  //
+  // \tparam From FromType to search for in bindings
+  // \return tuple of pointers to bindings, in binding order
+  //
+  // This is the lookup for multibindings, where several bindings contribute
+  // to one set. The number of bindings found is the tuple's size, so it is
+  // known at compile time; it is empty if none are found.
+  template <typename From>
+  constexpr auto find_bindings() noexcept -> auto {
+    return [this]<std::size_t... indices>(std::index_sequence<indices...>) {
+      return std::tuple{&detail::get<indices>(bindings_)...};
+    }(detail::binding_indices<From, BindingsTuple>);
+  }
+
  private:
-  [[dink_no_unique_address]] BindingsTuple bindings_;
+  using Storage =
+      detail::BindingStorage<std::index_sequence_for<Bindings...>, Bindings...>;
+
+  [[dink_no_unique_address]] Storage bindings_;
 };
 
 // ----------------------------------------------------------------------------
 // Deduction Guides
 // ----------------------------------------------------------------------------
 
+//! Deduces bindings from a tuple of bindings.
+template <typename... Bindings>
+Config(std::tuple<Bindings...>) -> Config<Bindings...>;
+
 //! Converts args to actual bindings.
 template <IsConvertibleToBinding... Args>
 Config(Args&&...)
@@ -47,6 +47,67 @@ struct BindingIndexTest {
                 "should find first matching binding in middle");
 };
 
+// ----------------------------------------------------------------------------
+// BindingIndices
+// ----------------------------------------------------------------------------
+
+struct BindingIndicesTest {
+  struct Found {};
+  struct NotFound {};
+
+  template <typename From, typename... Types>
+  static constexpr auto test_case =
+      binding_indices<From, std::tuple<decltype(Binding{bind<Types>()})...>>;
+
+  template <std::size_t... indices>
+  using Expected = const std::index_sequence<indices...>;
+
+  // Zero
+  static_assert(std::same_as<Expected<>, decltype(test_case<Found>)>,
+                "should find nothing in empty bindings");
+
+  // One
+  static_assert(std::same_as<Expected<0>, decltype(test_case<Found, Found>)>,
+                "should find single binding");
+  static_assert(std::same_as<Expected<>, decltype(test_case<Found, NotFound>)>,
+                "should not find single binding");
+
+  // Many
+  static_assert(
+      std::same_as<Expected<1>,
+                   decltype(test_case<Found, NotFound, Found, NotFound>)>,
+      "should find unique matching binding");
+  static_assert(
+      std::same_as<Expected<0, 2, 3>,
+                   decltype(test_case<Found, Found, NotFound, Found, Found>)>,
+      "should find all matching bindings in order");
+  static_assert(
+      std::same_as<Expected<>,
+                   decltype(test_case<Found, NotFound, NotFound, NotFound>)>,
+      "should not find matching binding");
+};
+
+// ----------------------------------------------------------------------------
+// BindingStorage
+// ----------------------------------------------------------------------------
+
+struct BindingStorageTest {
+  using Binding0 = Binding<int_t, scope::Transient, provider::Ctor<int_t>>;
+  using Binding1 = Binding<int_t, scope::Singleton, provider::Ctor<int_t>>;
+  using Storage = BindingStorage<std::index_sequence<0, 1, 2>, Binding0,
+                                 Binding1, Binding0>;
+
+  static_assert(
+      std::same_as<Binding0&, decltype(get<0>(std::declval<Storage&>()))>,
+      "should get binding at front");
+  static_assert(
+      std::same_as<Binding1&, decltype(get<1>(std::declval<Storage&>()))>,
+      "should get binding in middle");
+  static_assert(
+      std::same_as<Binding0&, decltype(get<2>(std::declval<Storage&>()))>,
+      "should get repeated binding at back");
+};
+
 }  // namespace
 }  // namespace detail
 
@@ -110,6 +171,21 @@ struct ConfigTest {
   static_assert(std::same_as<std::nullptr_t,
                              decltype(sut.template find_binding<void*>())>,
                 "should not find binding");
+
+  // find_bindings.
+  static inline auto multi_sut = Config{binding0, binding1, binding0};
+  static_assert(
+      std::same_as<std::tuple<Binding0*, Binding0*>,
+                   decltype(multi_sut.template find_bindings<int_t>())>,
+      "should find every binding0");
+  static_assert(
+      std::same_as<std::tuple<Binding1*>,
+                   decltype(multi_sut.template find_bindings<uint_t>())>,
+      "should find binding1");
+  static_assert(
+      std::same_as<std::tuple<>,
+                   decltype(multi_sut.template find_bindings<void>())>,
+      "should not find bindings");
 };
 
 // ----------------------------------------------------------------------------
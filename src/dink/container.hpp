@@ -8,10 +8,42 @@
 
 #include <dink/lib.hpp>
 #include <dink/binding.hpp>
-#include <dink/cache.hpp>
+#include <dink/cache_type.hpp>
 #include <dink/config.hpp>
+#include <dink/cycle.hpp>
 #include <dink/dispatcher.hpp>
+#include <dink/emplacer.hpp>
 #include <dink/meta.hpp>
+#include <dink/scope.hpp>
+#include <dink/type_list.hpp>
+#include <concepts>
+#include <cstddef>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+//! Controls whether Container::resolve() is kept out of line.
+//
+// By default, each call to resolve() may inline the whole resolution chain
+// into its call site. When this is nonzero, resolve() is never inlined, so each
+// (container, requested type) pair is emitted once, as a thunk that every call
+// site calls. Reference and pointer requests are reshaped into the canonical
+// type's reference, so those share one thunk per canonical type. This trades a
+// call per resolution for binary size.
+//
+// This must have the same value in every translation unit, e.g. set it with
+// target_compile_definitions.
+#if !defined dink_outline_resolution
+#define dink_outline_resolution 0
+#endif
+
+// clang-format off
+#if dink_outline_resolution
+  #define dink_detail_resolve_inlining dink_noinline
+#else
+  #define dink_detail_resolve_inlining
+#endif
+// clang-format on
 
 namespace dink {
 
@@ -51,6 +83,108 @@ concept IsTag =
 template <typename Tag>
 concept IsTagArg = IsTag<Tag> && !std::same_as<Tag, void>;
 
+// ----------------------------------------------------------------------------
+// Multiple Resolution
+// ----------------------------------------------------------------------------
+
+namespace container::detail {
+
+//! Element of a ResolvedTuple, distinguished from the others by its index.
+template <std::size_t index, typename Element>
+struct ResolvedTupleElement {
+  Element element;
+};
+
+//! Finds the element at index by deducing its type from the base class.
+template <std::size_t index, typename Element>
+constexpr auto element_at(ResolvedTupleElement<index, Element>& element) noexcept
+    -> ResolvedTupleElement<index, Element>& {
+  return element;
+}
+
+template <std::size_t index, typename Element>
+constexpr auto element_at(
+    const ResolvedTupleElement<index, Element>& element) noexcept
+    -> const ResolvedTupleElement<index, Element>& {
+  return element;
+}
+
+template <typename Indices, typename... Elements>
+struct ResolvedTuple;
+
+//! Tuple-like aggregate of resolved instances.
+//
+// std::tuple direct-initializes its elements, which can't initialize a
+// non-movable element from an Emplacer portably. Each element here is an
+// aggregate member instead, copy-initialized from an Emplacer, so it is
+// initialized directly from the resolved prvalue.
+template <std::size_t... indices, typename... Elements>
+struct ResolvedTuple<std::index_sequence<indices...>, Elements...>
+    : ResolvedTupleElement<indices, Elements>... {
+  template <std::size_t index>
+  constexpr auto get() & noexcept -> decltype(auto) {
+    return (element_at<index>(*this).element);
+  }
+
+  template <std::size_t index>
+  constexpr auto get() const& noexcept -> decltype(auto) {
+    return (element_at<index>(*this).element);
+  }
+
+  template <std::size_t index>
+  constexpr auto get() && noexcept -> decltype(auto) {
+    using Element = decltype(element_at<index>(*this).element);
+    return static_cast<Element&&>(element_at<index>(*this).element);
+  }
+};
+
+}  // namespace container::detail
+
+//! Tuple of resolved instances, one element per requested type.
+//
+// This supports structured bindings and member get<index>(), but it is not a
+// std::tuple.
+template <typename... Requested>
+using ResolvedTuple =
+    container::detail::ResolvedTuple<std::index_sequence_for<Requested...>,
+                                     meta::RemoveRvalueRef<Requested>...>;
+
+//! Resolves each requested type into one tuple.
+//
+// Each element is copy-initialized from an Emplacer, so values are constructed
+// in place in the tuple without intermediate moves, and non-movable values are
+// supported. References and pointers alias the container's cached instances,
+// as they do with single resolution. The result supports structured bindings:
+//
+//   auto [a, b, c] = container.template resolve<A&, B&, C>();
+//
+// Binding lookup and parent delegation are determined at compile time, so each
+// element dispatches directly to its strategy. Singletons shared between the
+// requested types' graphs are built once and reused from the cache.
+//
+// Elements are resolved in order.
+template <typename... Requested, typename Container>
+auto resolve_tuple(Container& container) -> ResolvedTuple<Requested...> {
+  return ResolvedTuple<Requested...>{
+      {Emplacer<Requested, Container>{container}}...};
+}
+
+// ----------------------------------------------------------------------------
+// Optional Adapters
+// ----------------------------------------------------------------------------
+
+// resolve_with() and resolve_tree() resolve through these. They are defined in
+// override.hpp and unique_tree.hpp, which callers include to use them, so
+// containers that don't aren't charged for parsing them.
+
+template <typename Container, typename Dispatcher, typename Config,
+          typename ParentPtr, typename... Overrides>
+class OverridingContainer;
+
+template <typename Container, typename Dispatcher, typename Config,
+          typename ParentPtr>
+class TreeContainer;
+
 // ----------------------------------------------------------------------------
 // Container
 // ----------------------------------------------------------------------------
@@ -90,6 +224,44 @@ template <IsConfig Config = Config<>, typename Cache = cache::Type,
   requires(!IsConvertibleToBinding<Cache>)
 class Container;
 
+namespace container::detail {
+
+//! true if Config binds any type in scope::PerGraph.
+template <typename Config>
+inline constexpr auto binds_per_graph = false;
+
+template <typename... Bindings>
+inline constexpr auto binds_per_graph<dink::Config<Bindings...>> =
+    (std::same_as<typename Bindings::ScopeType, scope::PerGraph> || ...);
+
+//! true if resolving from Container may reach a PerGraph binding.
+//
+// Only these containers open a graph for each outermost resolution, so
+// containers that don't use PerGraph don't pay for it.
+template <typename Container>
+inline constexpr auto opens_graphs = false;
+
+template <typename Config, typename Cache, typename Dispatcher,
+          typename Parent, typename Tag>
+inline constexpr auto
+    opens_graphs<Container<Config, Cache, Dispatcher, Parent, Tag>> =
+        binds_per_graph<Config> || opens_graphs<Parent>;
+
+//! Calls resolve, in a new graph if Container may reach a PerGraph binding and
+//! no graph is open yet.
+template <typename Container, typename Resolve>
+auto resolve_in_graph(Resolve resolve) -> decltype(auto) {
+  if constexpr (opens_graphs<Container>) {
+    if (!scope::per_graph::Graph::current()) {
+      auto graph = scope::per_graph::Graph{};
+      return resolve();
+    }
+  }
+  return resolve();
+}
+
+}  // namespace container::detail
+
 //! Partial specialization where Parent = void produces a root container.
 template <IsConfig Config, typename Cache, typename Dispatcher, IsTag Tag>
   requires(!IsConvertibleToBinding<Cache>)
@@ -135,19 +307,134 @@ class Container<Config, Cache, Dispatcher, void, Tag> {
   Container(Container&&) = default;
   auto operator=(Container&&) -> Container& = default;
 
+  //! true if requests through this may refer to the current graph's instances.
+  //
+  // Requests made directly, or through handles, may not. Unless cycle
+  // detection tracks them, though, types constructed here resolve their
+  // dependencies through this, too, so it can't tell them apart.
+  // \sa scope::PerGraph
+  static constexpr auto resolves_within_graph = !dink_detect_cycles;
+
   //! Resolve a dependency.
+  //
+  // Defined out of line so explicit instantiation declarations suppress its
+  // instantiation at every optimization level. \sa instantiate.hpp
+  //
+  // If this container may reach a PerGraph binding, the outermost call opens
+  // the graph its instances are shared in. \sa scope::PerGraph
+  //
+  // This is noexcept when nothing in the graph behind Requested can throw:
+  // every ctor and factory it invokes is noexcept, and nothing is allocated.
+  //
+  // \sa dink_outline_resolution
   template <typename Requested>
-  auto resolve() -> meta::RemoveRvalueRef<Requested> {
-    return dispatcher_.template resolve<Requested>(*this, config_, nullptr);
+  [[dink_detail_resolve_inlining]] auto resolve() noexcept(noexcept(
+      dispatcher_.template resolve<Requested>(*this, config_, nullptr)))
+      -> meta::RemoveRvalueRef<Requested>;
+
+  //! Resolve a dependency, overriding parts of its subgraph.
+  //
+  // Include override.hpp to call this. \sa override.hpp
+  template <typename Requested, typename... Overrides>
+  auto resolve_with(Overrides&&... overrides)
+      -> meta::RemoveRvalueRef<Requested> {
+    auto container =
+        OverridingContainer<Container, Dispatcher, Config, std::nullptr_t,
+                            std::remove_cvref_t<Overrides>...>{
+            *this, dispatcher_, config_, nullptr,
+            std::forward<Overrides>(overrides)...};
+    return container::detail::resolve_in_graph<Container>(
+        [&]() -> decltype(auto) {
+          return container.template resolve<Requested>();
+        });
+  }
+
+  //! Resolve a transient unique_ptr tree into one allocation.
+  //
+  // Include unique_tree.hpp to call this. \sa unique_tree.hpp
+  template <typename Root>
+  auto resolve_tree() -> auto {
+    using Tree = TreeContainer<Container, Dispatcher, Config, std::nullptr_t>;
+    return container::detail::resolve_in_graph<Container>(
+        [&]() -> decltype(auto) {
+          return Tree::template resolve_root<Root>(*this, dispatcher_, config_,
+                                                   nullptr);
+        });
+  }
+
+  //! Resolve several dependencies at once.
+  //
+  // \sa resolve_tuple()
+  template <typename First, typename Second, typename... Rest>
+  auto resolve() -> ResolvedTuple<First, Second, Rest...> {
+    return resolve_tuple<First, Second, Rest...>(*this);
+  }
+
+  //! Resolve every contribution to the set of Element.
+  //
+  // \sa multibinding.hpp
+  template <typename Element>
+  auto resolve_set() -> auto {
+    return dispatcher_.template resolve_set<Element>(*this, config_, nullptr);
+  }
+
+  //! Create Requested with its bound provider, resolving through requesting.
+  //
+  // \sa assisted_factory.hpp
+  template <typename Requested, typename Requesting>
+  auto create(Requesting& requesting) -> Requested {
+    return dispatcher_.template create<Requested>(requesting, config_, nullptr);
+  }
+
+  //! Resolve Requested with its binding, resolving through requesting.
+  //
+  // \sa CycleCheckingContainer
+  template <typename Requested, typename Requesting>
+  auto dispatch(Requesting& requesting) noexcept(noexcept(
+      dispatcher_.template resolve<Requested>(requesting, config_, nullptr)))
+      -> meta::RemoveRvalueRef<Requested> {
+    return dispatcher_.template resolve<Requested>(requesting, config_,
+                                                   nullptr);
+  }
+
+  //! Resolve every contribution to the set of Element through requesting.
+  template <typename Element, typename Requesting>
+  auto dispatch_set(Requesting& requesting) -> auto {
+    return dispatcher_.template resolve_set<Element>(requesting, config_,
+                                                     nullptr);
   }
 
   //! Get or create cached entry.
+  //
+  // With cycle detection, the entry is created through an adapter that tracks
+  // it, and notes that it outlives any graph. \sa scope::PerGraph
   template <typename Provider>
-  auto get_or_create(Provider& provider) -> Provider::Provided& {
-    return cache_.get_or_create(*this, provider);
+  auto get_or_create(Provider& provider) noexcept(
+      noexcept(cache_.get_or_create(std::declval<Caching&>(), provider)))
+      -> Provider::Provided& {
+    if constexpr (dink_detect_cycles) {
+      auto caching = Caching{*this};
+      return cache_.get_or_create(caching, provider);
+    } else {
+      return cache_.get_or_create(*this, provider);
+    }
+  }
+
+  //! Begin constructing Constructed, tracking it to detect cycles.
+  //
+  // \sa dink_detect_cycles
+  template <typename Constructed>
+  auto enter() noexcept -> auto {
+    return CycleCheckingContainer<Container, TypeList<Constructed>>{*this};
   }
 
  private:
+  //! Container cached instances are created through.
+  using Caching =
+      std::conditional_t<dink_detect_cycles,
+                         CycleCheckingContainer<Container, TypeList<>, true>,
+                         Container>;
+
   [[dink_no_unique_address]] Cache cache_{};
   [[dink_no_unique_address]] Dispatcher dispatcher_{};
   Config config_{};
@@ -206,25 +493,169 @@ class Container {
   Container(Container&&) = default;
   auto operator=(Container&&) -> Container& = default;
 
+  //! true if requests through this may refer to the current graph's instances.
+  //
+  // Requests made directly, or through handles, may not. Unless cycle
+  // detection tracks them, though, types constructed here resolve their
+  // dependencies through this, too, so it can't tell them apart.
+  // \sa scope::PerGraph
+  static constexpr auto resolves_within_graph = !dink_detect_cycles;
+
   //! Resolve a dependency.
+  //
+  // Defined out of line so explicit instantiation declarations suppress its
+  // instantiation at every optimization level. \sa instantiate.hpp
+  //
+  // If this container may reach a PerGraph binding, the outermost call opens
+  // the graph its instances are shared in. \sa scope::PerGraph
+  //
+  // This is noexcept when nothing in the graph behind Requested can throw:
+  // every ctor and factory it invokes is noexcept, and nothing is allocated.
+  //
+  // \sa dink_outline_resolution
   template <typename Requested>
-  auto resolve() -> meta::RemoveRvalueRef<Requested> {
-    return dispatcher_.template resolve<Requested>(*this, config_, parent_);
+  [[dink_detail_resolve_inlining]] auto resolve() noexcept(noexcept(
+      dispatcher_.template resolve<Requested>(*this, config_, parent_)))
+      -> meta::RemoveRvalueRef<Requested>;
+
+  //! Resolve a dependency, overriding parts of its subgraph.
+  //
+  // Include override.hpp to call this. \sa override.hpp
+  template <typename Requested, typename... Overrides>
+  auto resolve_with(Overrides&&... overrides)
+      -> meta::RemoveRvalueRef<Requested> {
+    auto container =
+        OverridingContainer<Container, Dispatcher, Config, Parent*,
+                            std::remove_cvref_t<Overrides>...>{
+            *this, dispatcher_, config_, parent_,
+            std::forward<Overrides>(overrides)...};
+    return container::detail::resolve_in_graph<Container>(
+        [&]() -> decltype(auto) {
+          return container.template resolve<Requested>();
+        });
+  }
+
+  //! Resolve a transient unique_ptr tree into one allocation.
+  //
+  // Include unique_tree.hpp to call this. \sa unique_tree.hpp
+  template <typename Root>
+  auto resolve_tree() -> auto {
+    using Tree = TreeContainer<Container, Dispatcher, Config, Parent*>;
+    return container::detail::resolve_in_graph<Container>(
+        [&]() -> decltype(auto) {
+          return Tree::template resolve_root<Root>(*this, dispatcher_, config_,
+                                                   parent_);
+        });
+  }
+
+  //! Resolve several dependencies at once.
+  //
+  // \sa resolve_tuple()
+  template <typename First, typename Second, typename... Rest>
+  auto resolve() -> ResolvedTuple<First, Second, Rest...> {
+    return resolve_tuple<First, Second, Rest...>(*this);
+  }
+
+  //! Resolve every contribution to the set of Element.
+  //
+  // \sa multibinding.hpp
+  template <typename Element>
+  auto resolve_set() -> auto {
+    return dispatcher_.template resolve_set<Element>(*this, config_, parent_);
+  }
+
+  //! Create Requested with its bound provider, resolving through requesting.
+  //
+  // \sa assisted_factory.hpp
+  template <typename Requested, typename Requesting>
+  auto create(Requesting& requesting) -> Requested {
+    return dispatcher_.template create<Requested>(requesting, config_, parent_);
+  }
+
+  //! Resolve Requested with its binding, resolving through requesting.
+  //
+  // \sa CycleCheckingContainer
+  template <typename Requested, typename Requesting>
+  auto dispatch(Requesting& requesting) noexcept(noexcept(
+      dispatcher_.template resolve<Requested>(requesting, config_, parent_)))
+      -> meta::RemoveRvalueRef<Requested> {
+    return dispatcher_.template resolve<Requested>(requesting, config_,
+                                                   parent_);
+  }
+
+  //! Resolve every contribution to the set of Element through requesting.
+  template <typename Element, typename Requesting>
+  auto dispatch_set(Requesting& requesting) -> auto {
+    return dispatcher_.template resolve_set<Element>(requesting, config_,
+                                                     parent_);
   }
 
   //! Get or create cached entry.
+  //
+  // With cycle detection, the entry is created through an adapter that tracks
+  // it, and notes that it outlives any graph. \sa scope::PerGraph
   template <typename Provider>
-  auto get_or_create(Provider& provider) -> Provider::Provided& {
-    return cache_.get_or_create(*this, provider);
+  auto get_or_create(Provider& provider) noexcept(
+      noexcept(cache_.get_or_create(std::declval<Caching&>(), provider)))
+      -> Provider::Provided& {
+    if constexpr (dink_detect_cycles) {
+      auto caching = Caching{*this};
+      return cache_.get_or_create(caching, provider);
+    } else {
+      return cache_.get_or_create(*this, provider);
+    }
+  }
+
+  //! Begin constructing Constructed, tracking it to detect cycles.
+  //
+  // \sa dink_detect_cycles
+  template <typename Constructed>
+  auto enter() noexcept -> auto {
+    return CycleCheckingContainer<Container, TypeList<Constructed>>{*this};
   }
 
  private:
+  //! Container cached instances are created through.
+  using Caching =
+      std::conditional_t<dink_detect_cycles,
+                         CycleCheckingContainer<Container, TypeList<>, true>,
+                         Container>;
+
   [[dink_no_unique_address]] Cache cache_{};
   [[dink_no_unique_address]] Dispatcher dispatcher_{};
   Config config_{};
   Parent* parent_{};
 };
 
+// ----------------------------------------------------------------------------
+// Out-of-Line Definitions
+// ----------------------------------------------------------------------------
+
+template <IsConfig Config, typename Cache, typename Dispatcher, IsTag Tag>
+  requires(!IsConvertibleToBinding<Cache>)
+template <typename Requested>
+auto Container<Config, Cache, Dispatcher, void, Tag>::resolve() noexcept(
+    noexcept(dispatcher_.template resolve<Requested>(*this, config_, nullptr)))
+    -> meta::RemoveRvalueRef<Requested> {
+  return container::detail::resolve_in_graph<Container>(
+      [&]() -> decltype(auto) {
+        return dispatcher_.template resolve<Requested>(*this, config_, nullptr);
+      });
+}
+
+template <IsConfig Config, typename Cache, typename Dispatcher,
+          IsParentContainer Parent, IsTag Tag>
+  requires(!IsConvertibleToBinding<Cache>)
+template <typename Requested>
+auto Container<Config, Cache, Dispatcher, Parent, Tag>::resolve() noexcept(
+    noexcept(dispatcher_.template resolve<Requested>(*this, config_, parent_)))
+    -> meta::RemoveRvalueRef<Requested> {
+  return container::detail::resolve_in_graph<Container>(
+      [&]() -> decltype(auto) {
+        return dispatcher_.template resolve<Requested>(*this, config_, parent_);
+      });
+}
+
 // ----------------------------------------------------------------------------
 // Deduction Guides
 // ----------------------------------------------------------------------------
@@ -306,3 +737,17 @@ Container(Tag, Parent& parent, Cache cache, Bindings&&...)
   }
 
 }  // namespace dink
+
+// Tuple protocol, for structured bindings of dink::ResolvedTuple.
+
+template <std::size_t... indices, typename... Elements>
+struct std::tuple_size<dink::container::detail::ResolvedTuple<
+    std::index_sequence<indices...>, Elements...>>
+    : std::integral_constant<std::size_t, sizeof...(Elements)> {};
+
+template <std::size_t index, std::size_t... indices, typename... Elements>
+struct std::tuple_element<index, dink::container::detail::ResolvedTuple<
+                                     std::index_sequence<indices...>,
+                                     Elements...>> {
+  using type = std::tuple_element_t<index, std::tuple<Elements...>>;
+};
@@ -5,6 +5,7 @@
 #include "container.hpp"
 #include <dink/test.hpp>
 #include <dink/binding.hpp>
+#include <dink/cache_instance.hpp>
 
 namespace dink {
 namespace {
@@ -290,5 +291,25 @@ TEST_F(ContainerTest, resolve_child) {
   ASSERT_EQ(&result, &requested);
 }
 
+using ResolvedMultiple = ResolvedTuple<int_t&, int_t*, int_t&&>;
+static_assert(std::tuple_size_v<ResolvedMultiple> == 3);
+static_assert(std::same_as<int_t&, std::tuple_element_t<0, ResolvedMultiple>>);
+static_assert(std::same_as<int_t*, std::tuple_element_t<1, ResolvedMultiple>>);
+static_assert(std::same_as<int_t, std::tuple_element_t<2, ResolvedMultiple>>);
+
+TEST_F(ContainerTest, resolve_multiple) {
+  EXPECT_CALL(mock_dispatcher,
+              resolve_reference(Ref(parent), A<ParentConfig&>(), nullptr))
+      .WillOnce(ReturnRef(requested));
+  EXPECT_CALL(mock_dispatcher,
+              resolve_value(Ref(parent), A<ParentConfig&>(), nullptr))
+      .WillOnce(Return(Requested{Requested::expected_id}));
+
+  auto [reference, value] = parent.template resolve<Requested&, Requested>();
+
+  ASSERT_EQ(&reference, &requested);
+  ASSERT_EQ(Requested::expected_id, value.id);
+}
+
 }  // namespace
 }  // namespace dink
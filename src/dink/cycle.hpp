@@ -0,0 +1,268 @@
+// \file
+// Copyright (c) 2025 Frank Secilia
+// SPDX-License-Identifier: MIT
+//
+// \brief Compile-time detection of dependency cycles.
+//
+// A type that needs itself, directly or through its dependencies, would
+// recurse at runtime until the stack overflows, or until a cached instance's
+// initialization reenters itself. Instead, it fails to compile, and the
+// diagnostic names the cycle:
+//
+//   error: static assertion failed: Dependency cycle ...
+//   In instantiation of 'struct dink::DependencyCycle<A, dink::TypeList<A, B>>'
+//
+// The types being constructed are tracked at the type level. Each invoker
+// enters its constructed type before resolving its dependencies, which appends
+// it to the container's list of types under construction, and entering a type
+// already in the list is a cycle. Cached instances are created by the
+// underlying container, starting a new list, so creating them through the
+// current list is instantiated first, only to check it. Either way, the cycle
+// is reported before any exception specification or return type that depends
+// on itself.
+//
+// With dink_detect_cycles disabled, only cycles among types that declare their
+// injection, with dink_inject or InjectTraits, are found. Each declaring type's
+// declared dependencies are visited depth first, once, the first time one is
+// constructed, and reaching a type still on the path is a cycle. This follows
+// declarations, like a Plan, so it assumes each declaring type is constructed
+// as declared. Other cycles still fail to compile, but the diagnostic names
+// an exception specification that depends on itself instead.
+//
+// Nothing is checked at runtime. Handles, like Lazy and Provider, resolve
+// later, so they break cycles.
+
+#pragma once
+
+#include <dink/lib.hpp>
+#include <dink/adapter.hpp>
+#include <dink/canonical.hpp>
+#include <dink/handle.hpp>
+#include <dink/inject.hpp>
+#include <dink/meta.hpp>
+#include <dink/type_list.hpp>
+#include <type_traits>
+#include <utility>
+
+//! Controls whether cycles through undeclared types are reported as cycles.
+//
+// Cycles among declared types always are. This is on by default, but costs
+// compile time. The list of types under construction is part of the container
+// type each dependency is resolved through, so a type reached along several
+// paths is instantiated once per path, and nested resolutions no longer go
+// through Container::resolve(), so they aren't covered by explicit
+// instantiation declarations or dink_outline_resolution. Each level of the
+// graph also nests several template instantiations, so deep graphs may need a
+// larger -ftemplate-depth, and plans no longer flatten them. Disabling it in
+// release builds, once debug or CI builds have checked for cycles, avoids
+// that.
+//
+// This must have the same value in every translation unit, e.g. set it with
+// target_compile_definitions.
+#if !defined dink_detect_cycles
+#define dink_detect_cycles 1
+#endif
+
+namespace dink {
+
+//! Fails compilation, naming a dependency cycle.
+//
+// Constructed is needed to construct itself. Path lists the types under
+// construction when it was entered again, outermost first.
+template <typename Constructed, typename Path>
+struct DependencyCycle {
+  static_assert(meta::kDependentFalse<Constructed>,
+                "Dependency cycle: Constructed is needed to construct itself. "
+                "DependencyCycle<Constructed, Path> in this diagnostic names "
+                "the cycle.");
+};
+
+// ----------------------------------------------------------------------------
+// CycleCheckingContainer
+// ----------------------------------------------------------------------------
+
+//! Container adapter that tracks the types under construction.
+//
+// This is created on the stack when an invoker enters Constructed. It
+// dispatches through the container it was entered from, passing itself as the
+// container, so the dependencies of the type being constructed are resolved
+// through it and their invokers enter through it in turn. Overrides still
+// apply when that container is an OverridingContainer.
+//
+// Cached instances are created through the root container, since cache
+// entries are keyed on its type. Their creation is also instantiated through
+// this adapter, only to check it, so cycles through cached instances are
+// found, too.
+//
+// outlives_graph is true while constructing a cached instance. It outlives
+// the current graph, so its dependencies must not refer to the graph's
+// instances. \sa scope::PerGraph
+template <typename Container, typename Constructing,
+          bool outlives_graph = false>
+class CycleCheckingContainer : public ForwardingContainer<Container> {
+ public:
+  //! true if requests through this may refer to the current graph's instances.
+  static constexpr auto resolves_within_graph = !outlives_graph;
+
+  //! Dispatches with this as the container; handles bind to the container.
+  template <typename Requested>
+  auto resolve() noexcept(is_nothrow_resolve<Requested>())
+      -> meta::RemoveRvalueRef<Requested> {
+    if constexpr (IsHandle<Requested>) {
+      return this->container_.template resolve<Requested>();
+    } else {
+      return this->container_.template dispatch<Requested>(*this);
+    }
+  }
+
+  //! Resolves every contribution to the set of Element.
+  template <typename Element>
+  auto resolve_set() -> auto {
+    return this->container_.template dispatch_set<Element>(*this);
+  }
+
+  //! Gets or creates cached entry in the underlying container.
+  template <typename Provider>
+  auto get_or_create(Provider& provider) noexcept(
+      is_nothrow_get_or_create<Provider>()) -> Provider::Provided& {
+    using Provided = typename Provider::Provided;
+    if constexpr (is_checkable<Provider>) {
+      [[maybe_unused]] constexpr auto check =
+          &Provider::template create<Provided, CycleCheckingContainer>;
+    }
+    return this->container_.get_or_create(provider);
+  }
+
+  //! Begins constructing Constructed.
+  //
+  // \return adapter that also tracks Constructed, or after reporting a cycle,
+  // the underlying container, so instantiation stops
+  template <typename Constructed>
+  auto enter() noexcept -> decltype(auto) {
+    if constexpr (Constructing::template kContains<Constructed>) {
+      static_cast<void>(sizeof(DependencyCycle<Constructed, Constructing>));
+      return (this->container_);
+    } else {
+      return CycleCheckingContainer<
+          Container, typename Constructing::template Append<Constructed>,
+          outlives_graph>{this->container_};
+    }
+  }
+
+  explicit CycleCheckingContainer(Container& container) noexcept
+      : CycleCheckingContainer::ForwardingContainer{container} {}
+
+ private:
+  //! true if Provider can create its instance through this adapter.
+  template <typename Provider>
+  static constexpr auto is_checkable = requires {
+    &Provider::template create<typename Provider::Provided,
+                               CycleCheckingContainer>;
+  };
+
+  //! true if getting or creating Provider's cached entry cannot throw.
+  //
+  // The underlying container creates the entry with a new list of types under
+  // construction, so creating it through this adapter is instantiated first,
+  // only to check it, before the underlying container's exception
+  // specification needs it. Otherwise, a cycle through cached instances would
+  // be reported as an exception specification that depends on itself.
+  template <typename Provider>
+  static constexpr auto is_nothrow_get_or_create() noexcept -> bool {
+    using Provided = typename Provider::Provided;
+    if constexpr (is_checkable<Provider>) {
+      static_cast<void>(
+          noexcept(std::declval<Provider&>().template create<Provided>(
+              std::declval<CycleCheckingContainer&>())));
+    }
+    return noexcept(
+        std::declval<Container&>().get_or_create(std::declval<Provider&>()));
+  }
+
+  template <typename Requested>
+  static constexpr auto is_nothrow_resolve() noexcept -> bool {
+    if constexpr (IsHandle<Requested>) {
+      return noexcept(std::declval<Container&>().template resolve<Requested>());
+    } else {
+      return noexcept(std::declval<Container&>().template dispatch<Requested>(
+          std::declval<CycleCheckingContainer&>()));
+    }
+  }
+};
+
+namespace cycle {
+namespace detail {
+
+//! Visits each of Requests, then each of their declared dependencies.
+//
+// Path lists the types being visited, outermost first, and Done lists the
+// types whose dependencies were all visited, so each type is visited once per
+// graph. Reaching a type already on Path is a cycle. type is Done, with every
+// type visited appended.
+template <typename Path, typename Done, typename Requests>
+struct Visit;
+
+template <typename Path, typename Done>
+struct Visit<Path, Done, TypeList<>> {
+  using type = Done;
+};
+
+//! Visits Requested from the end of Path.
+//
+// \return std::type_identity of Done after visiting Requested
+template <typename Path, typename Done, typename Requested>
+constexpr auto visit() noexcept {
+  if constexpr (IsHandle<Requested>) {
+    return std::type_identity<Done>{};
+  } else {
+    using Node = Canonical<Requested>;
+    if constexpr (Done::template kContains<Node>) {
+      return std::type_identity<Done>{};
+    } else if constexpr (Path::template kContains<Node>) {
+      static_cast<void>(sizeof(DependencyCycle<Node, Path>));
+      return std::type_identity<Done>{};
+    } else {
+      using Visited = typename Visit<typename Path::template Append<Node>,
+                                     Done, InjectDependencies<Node>>::type;
+      return std::type_identity<typename Visited::template Append<Node>>{};
+    }
+  }
+}
+
+template <typename Path, typename Done, typename Requested,
+          typename... Requests>
+struct Visit<Path, Done, TypeList<Requested, Requests...>>
+    : Visit<Path, typename decltype(visit<Path, Done, Requested>())::type,
+            TypeList<Requests...>> {};
+
+//! Visits Constructed's declared dependencies.
+template <typename Constructed>
+using VisitDeclared = Visit<TypeList<Constructed>, TypeList<>,
+                            InjectDependencies<Constructed>>;
+
+}  // namespace detail
+
+//! Begins constructing Constructed from container.
+//
+// \return container to resolve Constructed's dependencies through
+template <typename Constructed, typename Container>
+constexpr auto enter(Container& container) noexcept -> decltype(auto) {
+  if constexpr (!dink_detect_cycles) {
+    static_cast<void>(sizeof(detail::VisitDeclared<Constructed>));
+  }
+
+  if constexpr (dink_detect_cycles &&
+                requires { container.template enter<Constructed>(); }) {
+    return container.template enter<Constructed>();
+  } else {
+    return (container);
+  }
+}
+
+//! Container that Constructed's dependencies are resolved through.
+template <typename Constructed, typename Container>
+using Entered = std::remove_reference_t<decltype(enter<Constructed>(
+    std::declval<Container&>()))>;
+
+}  // namespace cycle
+}  // namespace dink
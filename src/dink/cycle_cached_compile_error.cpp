@@ -0,0 +1,32 @@
+// \file
+// Copyright (c) 2025 Frank Secilia
+// SPDX-License-Identifier: MIT
+//
+// Must fail to compile, naming the cycle with DependencyCycle.
+//
+// Built on demand by the dink_cycle_cached_compile_error test. Neither type
+// declares its injection, and each is cached, so the cycle passes through the
+// cache twice.
+
+#include <dink/container.hpp>
+
+namespace dink {
+namespace {
+
+struct Second;
+
+struct First {
+  explicit First(Second&) noexcept {}
+};
+
+struct Second {
+  explicit Second(First&) noexcept {}
+};
+
+[[maybe_unused]] auto resolve_cycle() -> void {
+  auto container = Container{};
+  container.resolve<First>();
+}
+
+}  // namespace
+}  // namespace dink
@@ -0,0 +1,35 @@
+// \file
+// Copyright (c) 2025 Frank Secilia
+// SPDX-License-Identifier: MIT
+//
+// Must fail to compile, naming the cycle with DependencyCycle.
+//
+// Built on demand by the dink_cycle_compile_error test, and by the
+// dink_declared_cycle_compile_error test, with dink_detect_cycles disabled.
+// Both types declare their injection, so it is found either way.
+
+#include <dink/container.hpp>
+#include <memory>
+
+namespace dink {
+namespace {
+
+struct Second;
+
+struct First {
+  using dink_inject = First(std::shared_ptr<Second>);
+  explicit First(std::shared_ptr<Second>) noexcept {}
+};
+
+struct Second {
+  using dink_inject = Second(const First&);
+  explicit Second(const First&) noexcept {}
+};
+
+[[maybe_unused]] auto resolve_cycle() -> void {
+  auto container = Container{};
+  container.resolve<First>();
+}
+
+}  // namespace
+}  // namespace dink
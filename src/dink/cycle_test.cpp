@@ -0,0 +1,142 @@
+// \file
+// Copyright (c) 2025 Frank Secilia
+// SPDX-License-Identifier: MIT
+//
+// Cycles that must fail to compile are in cycle_compile_error.cpp and
+// cycle_cached_compile_error.cpp.
+
+#include "cycle.hpp"
+#include <dink/test.hpp>
+#include <dink/binding_dsl.hpp>
+#include <dink/container.hpp>
+#include <dink/lazy.hpp>
+#include <memory>
+
+static_assert(dink_detect_cycles, "cycle_test requires dink_detect_cycles.");
+
+namespace dink {
+namespace {
+
+struct CycleTest : Test {
+  static constexpr auto kValue = int_t{6151};  // Arbitrary.
+
+  struct Leaf {
+    using dink_inject = Leaf();
+    int_t value = kValue;
+  };
+
+  // Leaf is reached along two paths, which is not a cycle.
+  struct Left {
+    using dink_inject = Left(Leaf);
+    explicit Left(Leaf leaf) noexcept : leaf{leaf} {}
+    Leaf leaf;
+  };
+
+  struct Right {
+    using dink_inject = Right(const Leaf&);
+    explicit Right(const Leaf& leaf) noexcept : leaf{leaf} {}
+    const Leaf& leaf;
+  };
+
+  struct Diamond {
+    using dink_inject = Diamond(Left, std::shared_ptr<Right>, Leaf*);
+    Diamond(Left left, std::shared_ptr<Right> right, Leaf* leaf) noexcept
+        : left{left}, right{std::move(right)}, leaf{leaf} {}
+
+    Left left;
+    std::shared_ptr<Right> right;
+    Leaf* leaf;
+  };
+
+  struct Fields {
+    Leaf leaf;
+    std::unique_ptr<Right> right;
+    using dink_inject = InjectFields<&Fields::leaf, &Fields::right>;
+  };
+
+  struct Interface {
+    virtual ~Interface() = default;
+    virtual auto value() const noexcept -> int_t = 0;
+  };
+
+  struct Impl : Interface {
+    using dink_inject = Impl(Left);
+    explicit Impl(Left left) noexcept : left{left} {}
+    auto value() const noexcept -> int_t override { return left.leaf.value; }
+    Left left;
+  };
+
+  // Back and Forth need each other, but Lazy breaks the cycle.
+  struct Back;
+
+  struct Forth {
+    using dink_inject = Forth(Lazy<Back&, AnyContainer>);
+    explicit Forth(Lazy<Back&, AnyContainer> back) noexcept
+        : back{std::move(back)} {}
+    Lazy<Back&, AnyContainer> back;
+  };
+
+  struct Back {
+    using dink_inject = Back(Forth&);
+    explicit Back(Forth& forth) noexcept : forth{forth} {}
+    Forth& forth;
+  };
+};
+
+// ----------------------------------------------------------------------------
+// Acyclic Graphs
+// ----------------------------------------------------------------------------
+
+TEST_F(CycleTest, resolves_type_reached_along_several_paths) {
+  auto sut = dink_unique_container();
+
+  const auto result = sut.resolve<Diamond>();
+
+  ASSERT_EQ(kValue, result.left.leaf.value);
+  ASSERT_EQ(kValue, result.right->leaf.value);
+  ASSERT_EQ(&result.right->leaf, result.leaf);
+}
+
+TEST_F(CycleTest, resolves_bound_implementation) {
+  auto sut = dink_unique_container(bind<Interface>().as<Impl>());
+
+  ASSERT_EQ(kValue, sut.resolve<std::unique_ptr<Interface>>()->value());
+}
+
+TEST_F(CycleTest, resolves_via_factory) {
+  auto sut = dink_unique_container(
+      bind<Left>().via([](Leaf leaf) { return Left{leaf}; }));
+
+  ASSERT_EQ(kValue, sut.resolve<Left>().leaf.value);
+}
+
+TEST_F(CycleTest, resolves_injected_fields) {
+  auto sut = dink_unique_container();
+
+  const auto result = sut.resolve<Fields>();
+
+  ASSERT_EQ(kValue, result.leaf.value);
+  ASSERT_EQ(kValue, result.right->leaf.value);
+}
+
+TEST_F(CycleTest, resolves_from_parent) {
+  auto parent = dink_unique_container(bind<Leaf>().in<scope::Singleton>());
+  auto sut = dink_unique_container(parent);
+
+  ASSERT_EQ(&parent.resolve<Leaf&>(), &sut.resolve<Right>().leaf);
+}
+
+// ----------------------------------------------------------------------------
+// Handles
+// ----------------------------------------------------------------------------
+
+TEST_F(CycleTest, lazy_breaks_cycle) {
+  auto sut = dink_unique_container();
+
+  auto& forth = sut.resolve<Forth&>();
+
+  ASSERT_EQ(&forth, &forth.back->forth);
+}
+
+}  // namespace
+}  // namespace dink
@@ -0,0 +1,109 @@
+// \file
+// Copyright (c) 2025 Frank Secilia
+// SPDX-License-Identifier: MIT
+//
+// \brief Module interface exporting dink's public API.
+//
+// Importing this module instead of including the headers parses the library
+// and its standard headers once, when the module is built, rather than once
+// per translation unit:
+//
+//   import dink;
+//
+//   auto container = dink::Container{dink::bind<Service>()};
+//
+// Configuration macros, such as dink_max_deduced_arity, are fixed when the
+// module is built. Set them with target_compile_definitions on dink_module;
+// defining them before the import has no effect.
+
+module;
+
+#include <dink/lib.hpp>
+#include <dink/assisted_factory.hpp>
+#include <dink/binding.hpp>
+#include <dink/binding_dsl.hpp>
+#include <dink/cache.hpp>
+#include <dink/canonical.hpp>
+#include <dink/config.hpp>
+#include <dink/container.hpp>
+#include <dink/cycle.hpp>
+#include <dink/emplace.hpp>
+#include <dink/inject.hpp>
+#include <dink/inline_poly.hpp>
+#include <dink/lazy.hpp>
+#include <dink/multibinding.hpp>
+#include <dink/named.hpp>
+#include <dink/override.hpp>
+#include <dink/plan.hpp>
+#include <dink/provider.hpp>
+#include <dink/provider_handle.hpp>
+#include <dink/scope.hpp>
+#include <dink/unique_tree.hpp>
+#include <dink/version.hpp>
+
+export module dink;
+
+export namespace dink {
+
+// Containers and configuration.
+using dink::Binding;
+using dink::Config;
+using dink::Container;
+using dink::IsContainer;
+using dink::bind;
+
+// Resolution.
+using dink::AllocatedUniquePtr;
+using dink::Canonical;
+using dink::ResolvedTuple;
+using dink::TreeUniquePtr;
+using dink::emplacer;
+using dink::override;
+using dink::Plan;
+using dink::resolve_at;
+using dink::resolve_into;
+using dink::resolve_planned;
+using dink::resolve_tuple;
+using dink::resolve_unique;
+
+// Injectable types.
+using dink::AnyContainer;
+using dink::AssistedFactory;
+using dink::InlinePoly;
+using dink::Lazy;
+using dink::Named;
+using dink::NamedKey;
+using dink::Provider;
+using dink::provider_for;
+using dink::SetOf;
+
+// Injection declarations.
+using dink::InjectDependencies;
+using dink::InjectFields;
+using dink::InjectTraits;
+
+// Common types.
+using dink::int_t;
+using dink::uint_t;
+using dink::Version;
+using dink::version;
+
+namespace cache {
+using dink::cache::Instance;
+using dink::cache::Type;
+}  // namespace cache
+
+namespace provider {
+using dink::provider::Ctor;
+using dink::provider::External;
+using dink::provider::Factory;
+}  // namespace provider
+
+namespace scope {
+using dink::scope::Instance;
+using dink::scope::PerGraph;
+using dink::scope::Singleton;
+using dink::scope::Transient;
+}  // namespace scope
+
+}  // namespace dink
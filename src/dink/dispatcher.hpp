@@ -10,9 +10,15 @@
 #include <dink/binding.hpp>
 #include <dink/canonical.hpp>
 #include <dink/config.hpp>
+#include <dink/handle.hpp>
 #include <dink/meta.hpp>
+#include <dink/multibinding.hpp>
+#include <dink/named.hpp>
 #include <dink/provider.hpp>
 #include <dink/strategy.hpp>
+#include <concepts>
+#include <tuple>
+#include <type_traits>
 
 namespace dink {
 namespace defaults {
@@ -20,21 +26,60 @@ namespace defaults {
 //! Looks up bindings in config.
 struct BindingLocator {
   template <typename FromType, typename Config>
-  constexpr auto find(Config& config) const -> auto {
+  constexpr auto find(Config& config) const
+      noexcept(noexcept(config.template find_binding<FromType>())) -> auto {
     return config.template find_binding<FromType>();
   }
+
+  template <typename FromType, typename Config>
+  constexpr auto find_all(Config& config) const -> auto {
+    return config.template find_bindings<FromType>();
+  }
 };
 
 //! Creates effective bindings for unbound types.
 struct FallbackBindingFactory {
   template <typename FromType>
-  constexpr auto create() const -> auto {
+  constexpr auto create() const noexcept -> auto {
     return Binding<FromType, scope::Transient, provider::Ctor<FromType>>{};
   }
 };
 
 }  // namespace defaults
 
+namespace dispatcher::detail {
+
+//! Finds the reference a reshaped request is resolved through.
+//
+// Every lvalue reference or object pointer request for the same instance,
+// regardless of cv-qualification, is resolved through a mutable lvalue
+// reference to it, so binding lookup and caching are instantiated once per
+// canonical type. type is void for requests that aren't reshaped.
+template <typename Requested>
+struct SharedReference {
+  using type = void;
+};
+
+template <typename Referenced>
+struct SharedReference<Referenced&> {
+  using type = std::remove_cv_t<Referenced>&;
+};
+
+template <typename Pointee>
+  requires(!std::is_function_v<Pointee>)
+struct SharedReference<Pointee*> {
+  using type = std::remove_cv_t<Pointee>&;
+};
+
+//! true if Requested adapts a resolution of a different shared reference.
+template <typename Requested>
+concept IsReshaped =
+    !IsHandle<Requested> &&
+    !std::same_as<typename SharedReference<Requested>::type, void> &&
+    !std::same_as<typename SharedReference<Requested>::type, Requested>;
+
+}  // namespace dispatcher::detail
+
 // ----------------------------------------------------------------------------
 // Dispatcher
 // ----------------------------------------------------------------------------
@@ -52,11 +97,91 @@ class Dispatcher {
         fallback_binding_factory_{std::move(fallback_binding_factory)},
         strategy_factory_{std::move(strategy_factory)} {}
 
-  //! Resolves with found binding, delegates to parent, or uses fallback.
+  //! Resolves a set span, a qualified request, or through a binding.
   template <typename Requested, typename Container, typename Config,
             typename ParentPtr>
   auto resolve(Container& container, Config& config, ParentPtr parent)
-      -> meta::RemoveRvalueRef<Requested> {
+      noexcept(is_nothrow_resolve<Requested, Container, Config, ParentPtr>())
+          -> meta::RemoveRvalueRef<Requested> {
+    if constexpr (IsSetSpan<Requested>) {
+      return resolve_set_span<Requested>(container);
+    } else if constexpr (IsNamed<Requested>) {
+      static_assert(!std::is_lvalue_reference_v<Requested>,
+                    "Named must be requested by value.");
+      return resolve_named<meta::RemoveRvalueRef<Requested>>(container, config,
+                                                            parent);
+    } else if constexpr (dispatcher::detail::IsReshaped<Requested>) {
+      return resolve_reshaped<Requested>(container);
+    } else {
+      return resolve_binding<Requested>(container, config, parent);
+    }
+  }
+
+  //! Resolves every binding contributing to the set of Element.
+  //
+  // \return tuple of references to each contribution, in binding order
+  //
+  // Contributions are not merged across the hierarchy. If this container has
+  // any, they are the set. Otherwise, the parent's set is used, or the set is
+  // empty if there is no parent.
+  template <typename Element, typename Container, typename Config,
+            typename ParentPtr>
+  auto resolve_set(Container& container, Config& config, ParentPtr parent)
+      -> auto {
+    auto bindings =
+        binding_locator_.template find_all<SetOf<Element>>(config);
+    constexpr bool found_bindings =
+        std::tuple_size_v<decltype(bindings)> != 0;
+
+    if constexpr (found_bindings || std::same_as<ParentPtr, std::nullptr_t>) {
+      return std::apply(
+          [&](auto*... bindings) {
+            return std::tuple<typename std::remove_cvref_t<
+                decltype(*bindings)>::ProviderType::Provided&...>{
+                resolve_element(container, *bindings)...};
+          },
+          bindings);
+    } else {
+      return parent->template resolve_set<Element>();
+    }
+  }
+
+  //! Creates Requested with its binding's provider, bypassing its scope.
+  //
+  // The provider resolves Requested's dependencies through container, so it
+  // may supply some of them itself. If no binding is found, the parent's is
+  // used, or if there is no parent, the fallback binding's.
+  //
+  // \sa assisted_factory.hpp
+  template <typename Requested, typename Container, typename Config,
+            typename ParentPtr>
+  auto create(Container& container, Config& config, ParentPtr parent)
+      -> Requested {
+    using Canonical = Canonical<Requested>;
+
+    auto binding = binding_locator_.template find<Canonical>(config);
+    constexpr bool found_binding =
+        !std::is_same_v<decltype(binding), std::nullptr_t>;
+
+    if constexpr (found_binding) {
+      return binding->provider.template create<Requested>(container);
+    } else if constexpr (std::same_as<ParentPtr, std::nullptr_t>) {
+      auto fallback_binding =
+          fallback_binding_factory_.template create<Canonical>();
+      return fallback_binding.provider.template create<Requested>(container);
+    } else {
+      return parent->template create<Requested>(container);
+    }
+  }
+
+ private:
+  //! Resolves with found binding, delegates to parent, or uses fallback.
+  template <typename Requested, typename Container, typename Config,
+            typename ParentPtr>
+  auto resolve_binding(Container& container, Config& config, ParentPtr parent)
+      noexcept(is_nothrow_resolve_binding<Requested, Container, Config,
+                                          ParentPtr>())
+          -> meta::RemoveRvalueRef<Requested> {
     using Canonical = Canonical<Requested>;
 
     // Look up binding.
@@ -67,16 +192,19 @@ class Dispatcher {
     if constexpr (found_binding) {
       // Found binding - execute with it.
       using Binding = std::remove_cvref_t<decltype(*binding)>;
-      constexpr auto scope_provides_references =
-          Binding::ScopeType::provides_references;
+      using Scope = typename Binding::ScopeType;
 
       return execute_strategy<Requested, found_binding,
-                              scope_provides_references>(container, *binding);
-    } else if constexpr (std::same_as<ParentPtr, std::nullptr_t>) {
-      // no binding, no parent, use fallback bindings
+                              Scope::provides_references,
+                              Scope::provides_shared_ptrs>(container,
+                                                           *binding);
+    } else if constexpr (std::same_as<ParentPtr, std::nullptr_t> ||
+                         IsHandle<Requested>) {
+      // no binding and no parent, or a handle, which binds to this container
+      // rather than the parent; use fallback bindings
       auto fallback_binding =
           fallback_binding_factory_.template create<Canonical>();
-      return execute_strategy<Requested, false, false>(container,
+      return execute_strategy<Requested, false, false, true>(container,
                                                        fallback_binding);
     } else {
       // no binding, but still have parent to try.
@@ -84,19 +212,221 @@ class Dispatcher {
     }
   }
 
- private:
+  //! Resolves a qualified request using its qualified binding.
+  //
+  // The binding's provider is wrapped in provider::Qualified so anything the
+  // scope caches is keyed on the qualifier, too.
+  template <typename Requested, typename Container, typename Config,
+            typename ParentPtr>
+  auto resolve_named(Container& container, Config& config, ParentPtr parent)
+      noexcept(is_nothrow_resolve_named<Requested, Container, Config,
+                                        ParentPtr>()) -> Requested {
+    using Qualifier = typename Requested::QualifierType;
+    using Unqualified = typename Requested::RequestedType;
+
+    auto binding =
+        binding_locator_.template find<Canonical<Requested>>(config);
+    constexpr bool found_binding =
+        !std::is_same_v<decltype(binding), std::nullptr_t>;
+
+    if constexpr (found_binding) {
+      using Binding = std::remove_cvref_t<decltype(*binding)>;
+      using Scope = typename Binding::ScopeType;
+      using Provider =
+          provider::Qualified<Qualifier, typename Binding::ProviderType>;
+
+      // Cached shared_ptrs are keyed on the unqualified type, so they would
+      // alias the wrong instance.
+      static_assert(!meta::IsWeakPtr<Unqualified> &&
+                        !(meta::IsSharedPtr<Unqualified> &&
+                          !Scope::provides_shared_ptrs),
+                    "Named shared_ptr and weak_ptr require a transient "
+                    "binding; request a Named reference instead.");
+
+      auto qualified_binding = dink::Binding<typename Binding::FromType, Scope,
+                                             Provider>{
+          binding->scope, Provider{binding->provider}};
+      return Requested{
+          execute_strategy<Unqualified, true, Scope::provides_references,
+                           Scope::provides_shared_ptrs>(
+              container, qualified_binding)};
+    } else if constexpr (std::same_as<ParentPtr, std::nullptr_t>) {
+      static_assert(meta::kDependentFalse<Requested>,
+                    "Named requests must be bound; there is no fallback.");
+    } else {
+      return parent->template resolve<Requested>();
+    }
+  }
+
+  //! Adapts the shared reference to a cv-qualified reference or pointer.
+  //
+  // This is a thin shim. The shared reference is resolved through the
+  // container, so the strategy, scope, and provider chain behind it is
+  // instantiated once and shared by every request shape.
+  template <typename Requested, typename Container>
+  auto resolve_reshaped(Container& container) noexcept(noexcept(
+      container.template resolve<
+          typename dispatcher::detail::SharedReference<Requested>::type>()))
+      -> Requested {
+    using SharedReference =
+        typename dispatcher::detail::SharedReference<Requested>::type;
+    auto& instance = container.template resolve<SharedReference>();
+    if constexpr (std::is_pointer_v<Requested>) {
+      return &instance;
+    } else {
+      return instance;
+    }
+  }
+
+  //! Views the container's cached array of set element pointers.
+  template <typename Requested, typename Container>
+  auto resolve_set_span(Container& container) -> Requested {
+    using Element = multibinding::SpanElement<Requested>;
+    using Set = decltype(container.template resolve_set<
+                         std::remove_cv_t<Element>>());
+    constexpr auto size = std::tuple_size_v<Set>;
+    static_assert(Requested::extent == std::dynamic_extent ||
+                      Requested::extent == size,
+                  "Span extent must match the number of set bindings.");
+
+    auto provider = multibinding::ArrayProvider<Element, size>{};
+    return Requested{container.get_or_create(provider)};
+  }
+
+  //! Resolves one set contribution as a reference.
+  template <typename Container, typename Binding>
+  auto resolve_element(Container& container, Binding& binding)
+      -> Binding::ProviderType::Provided& {
+    using Requested = typename Binding::ProviderType::Provided&;
+    using Scope = typename Binding::ScopeType;
+    static_assert(!std::same_as<Scope, scope::PerGraph>,
+                  "Sets outlive the graph; bind elements in another scope.");
+    return execute_strategy<Requested, true, Scope::provides_references,
+                            Scope::provides_shared_ptrs>(container, binding);
+  }
+
   //! Executes strategy with given binding.
   template <typename Requested, bool found_binding,
-            bool scope_provides_references, typename Container,
-            typename Binding>
+            bool scope_provides_references, bool scope_provides_shared_ptrs,
+            typename Container, typename Binding>
   auto execute_strategy(Container& container, Binding& binding)
-      -> meta::RemoveRvalueRef<Requested> {
+      noexcept(noexcept(strategy_factory_
+                            .template create<Requested, found_binding,
+                                             scope_provides_references,
+                                             scope_provides_shared_ptrs>()
+                            .template execute<Requested>(container, binding)))
+          -> meta::RemoveRvalueRef<Requested> {
     auto strategy =
         strategy_factory_.template create<Requested, found_binding,
-                                          scope_provides_references>();
+                                          scope_provides_references,
+                                          scope_provides_shared_ptrs>();
     return strategy.template execute<Requested>(container, binding);
   }
 
+  // Each is_nothrow_ function mirrors the branches of the function it is
+  // named for, so only the branch taken is examined.
+
+  template <typename Requested, typename Container, typename Config,
+            typename ParentPtr>
+  static constexpr auto is_nothrow_resolve() noexcept -> bool {
+    if constexpr (IsSetSpan<Requested>) {
+      return noexcept(
+          std::declval<Dispatcher&>().template resolve_set_span<Requested>(
+              std::declval<Container&>()));
+    } else if constexpr (IsNamed<Requested>) {
+      return is_nothrow_resolve_named<meta::RemoveRvalueRef<Requested>,
+                                      Container, Config, ParentPtr>();
+    } else if constexpr (dispatcher::detail::IsReshaped<Requested>) {
+      return noexcept(
+          std::declval<Dispatcher&>().template resolve_reshaped<Requested>(
+              std::declval<Container&>()));
+    } else {
+      return is_nothrow_resolve_binding<Requested, Container, Config,
+                                        ParentPtr>();
+    }
+  }
+
+  template <typename Requested, typename Container, typename Config,
+            typename ParentPtr>
+  static constexpr auto is_nothrow_resolve_binding() noexcept -> bool {
+    using Canonical = Canonical<Requested>;
+    using BindingPtr = decltype(std::declval<BindingLocator&>()
+                                    .template find<Canonical>(
+                                        std::declval<Config&>()));
+
+    constexpr auto is_nothrow_find =
+        noexcept(std::declval<BindingLocator&>().template find<Canonical>(
+            std::declval<Config&>()));
+    if constexpr (!std::is_same_v<BindingPtr, std::nullptr_t>) {
+      using Binding = std::remove_pointer_t<BindingPtr>;
+      using Scope = typename Binding::ScopeType;
+      return is_nothrow_find &&
+             is_nothrow_execute<Requested, true, Scope::provides_references,
+                                Scope::provides_shared_ptrs, Container,
+                                Binding>();
+    } else if constexpr (std::same_as<ParentPtr, std::nullptr_t> ||
+                         IsHandle<Requested>) {
+      using Binding = decltype(std::declval<FallbackBindingFactory&>()
+                                   .template create<Canonical>());
+      return is_nothrow_find &&
+             noexcept(std::declval<FallbackBindingFactory&>()
+                          .template create<Canonical>()) &&
+             is_nothrow_execute<Requested, false, false, true, Container,
+                                Binding>();
+    } else {
+      return is_nothrow_find &&
+             noexcept(std::declval<ParentPtr>()->template resolve<Requested>());
+    }
+  }
+
+  template <typename Requested, typename Container, typename Config,
+            typename ParentPtr>
+  static constexpr auto is_nothrow_resolve_named() noexcept -> bool {
+    using Canonical = Canonical<Requested>;
+    using BindingPtr = decltype(std::declval<BindingLocator&>()
+                                    .template find<Canonical>(
+                                        std::declval<Config&>()));
+
+    if constexpr (!std::is_same_v<BindingPtr, std::nullptr_t>) {
+      using Binding = std::remove_pointer_t<BindingPtr>;
+      using Scope = typename Binding::ScopeType;
+      using Provider = provider::Qualified<typename Requested::QualifierType,
+                                           typename Binding::ProviderType>;
+      using QualifiedBinding =
+          dink::Binding<typename Binding::FromType, Scope, Provider>;
+      return noexcept(std::declval<BindingLocator&>().template find<Canonical>(
+                 std::declval<Config&>())) &&
+             is_nothrow_execute<typename Requested::RequestedType, true,
+                                Scope::provides_references,
+                                Scope::provides_shared_ptrs, Container,
+                                QualifiedBinding>() &&
+             std::is_nothrow_constructible_v<
+                 Requested, meta::RemoveRvalueRef<
+                                typename Requested::RequestedType>>;
+    } else if constexpr (std::same_as<ParentPtr, std::nullptr_t>) {
+      return true;
+    } else {
+      return noexcept(std::declval<ParentPtr>()->template resolve<Requested>());
+    }
+  }
+
+  template <typename Requested, bool found_binding,
+            bool scope_provides_references, bool scope_provides_shared_ptrs,
+            typename Container, typename Binding>
+  static constexpr auto is_nothrow_execute() noexcept -> bool {
+    using Strategy =
+        decltype(std::declval<StrategyFactory&>()
+                     .template create<Requested, found_binding,
+                                      scope_provides_references,
+                                      scope_provides_shared_ptrs>());
+    return noexcept(std::declval<StrategyFactory&>()
+                        .template create<Requested, found_binding,
+                                         scope_provides_references,
+                                         scope_provides_shared_ptrs>()) &&
+           noexcept(std::declval<Strategy&>().template execute<Requested>(
+               std::declval<Container&>(), std::declval<Binding&>()));
+  }
+
   [[dink_no_unique_address]] BindingLocator binding_locator_{};
   [[dink_no_unique_address]] FallbackBindingFactory fallback_binding_factory_{};
   [[dink_no_unique_address]] StrategyFactory strategy_factory_{};
@@ -75,12 +75,14 @@ struct DispatcherTest : Test {
   struct ReferenceBinding : UntypedBinding {
     struct ScopeType {
       [[maybe_unused]] static constexpr auto provides_references = true;
+      [[maybe_unused]] static constexpr auto provides_shared_ptrs = false;
     };
   };
 
   struct ValueBinding : UntypedBinding {
     struct ScopeType {
       [[maybe_unused]] static constexpr auto provides_references = false;
+      [[maybe_unused]] static constexpr auto provides_shared_ptrs = true;
     };
   };
 
@@ -111,7 +113,8 @@ struct DispatcherTest : Test {
 
   struct MockStrategyFactory {
     MOCK_METHOD(Strategy, create,
-                (bool found_binding, bool scope_provides_references));
+                (bool found_binding, bool scope_provides_references,
+                 bool scope_provides_shared_ptrs));
     virtual ~MockStrategyFactory() = default;
   };
   StrictMock<MockStrategyFactory> mock_strategy_factory;
@@ -120,10 +123,11 @@ struct DispatcherTest : Test {
     MockStrategyFactory* mock = nullptr;
 
     template <typename Requested, bool found_binding,
-              bool scope_provides_references>
+              bool scope_provides_references, bool scope_provides_shared_ptrs>
     constexpr auto create() -> Strategy {
       static_assert(std::same_as<DispatcherTest::Requested&, Requested>);
-      return mock->create(found_binding, scope_provides_references);
+      return mock->create(found_binding, scope_provides_references,
+                          scope_provides_shared_ptrs);
     }
   };
 };
@@ -170,7 +174,7 @@ struct DispatcherTestBindingFoundReferenceBinding : DispatcherTestBindingFound {
 TEST_F(DispatcherTestBindingFoundReferenceBinding, ResolveExecutesStrategy) {
   EXPECT_CALL(mock_binding_locator, find(Ref(config)))
       .WillOnce(Return(&binding));
-  EXPECT_CALL(mock_strategy_factory, create(true, true))
+  EXPECT_CALL(mock_strategy_factory, create(true, true, false))
       .WillOnce(Return(Strategy{&mock_strategy}));
 
   EXPECT_CALL(mock_strategy, execute(Ref(container), Ref(binding)))
@@ -198,7 +202,7 @@ struct DispatcherTestBindingFoundValueBinding : DispatcherTestBindingFound {
 TEST_F(DispatcherTestBindingFoundValueBinding, ResolveExecutesStrategy) {
   EXPECT_CALL(mock_binding_locator, find(Ref(config)))
       .WillOnce(Return(&binding));
-  EXPECT_CALL(mock_strategy_factory, create(true, false))
+  EXPECT_CALL(mock_strategy_factory, create(true, false, true))
       .WillOnce(Return(Strategy{&mock_strategy}));
 
   EXPECT_CALL(mock_strategy, execute(Ref(container), binding))
@@ -249,7 +253,7 @@ struct DispatcherTestBindingNotFoundUseFallback
 
 TEST_F(DispatcherTestBindingNotFoundUseFallback,
        ResolveExecutesFallbackStrategy) {
-  EXPECT_CALL(mock_strategy_factory, create(false, false))
+  EXPECT_CALL(mock_strategy_factory, create(false, false, true))
       .WillOnce(Return(Strategy{&mock_strategy}));
   EXPECT_CALL(mock_strategy, execute(Ref(container), binding))
       .WillOnce(ReturnRef(requested));
@@ -294,5 +298,60 @@ TEST_F(DispatcherTestBindingNotFoundHasParent, ResolveDelegatesToParent) {
   ASSERT_EQ(&result, &requested);
 }
 
+// Reshaped Requests
+// ----------------------------------------------------------------------------
+
+struct DispatcherTestReshaped : DispatcherTestBindingNotFound {
+  struct FallbackBindingFactory {};
+
+  struct MockReshapingContainer {
+    MOCK_METHOD(Requested&, resolve, ());
+    virtual ~MockReshapingContainer() = default;
+  };
+  StrictMock<MockReshapingContainer> mock_container{};
+
+  struct ReshapingContainer {
+    template <typename Requested>
+    auto resolve() -> Requested {
+      static_assert(std::same_as<DispatcherTest::Requested&, Requested>);
+      return mock->resolve();
+    }
+    MockReshapingContainer* mock = nullptr;
+  };
+  ReshapingContainer reshaping_container{&mock_container};
+
+  using Sut =
+      Dispatcher<BindingLocator, FallbackBindingFactory, StrategyFactory>;
+  Sut sut{BindingLocator{}, FallbackBindingFactory{},
+          StrategyFactory{&mock_strategy_factory}};
+};
+
+TEST_F(DispatcherTestReshaped, ConstReferenceResolvesSharedReference) {
+  EXPECT_CALL(mock_container, resolve()).WillOnce(ReturnRef(requested));
+
+  auto& result = sut.template resolve<const Requested&>(reshaping_container,
+                                                        config, nullptr);
+
+  ASSERT_EQ(&result, &requested);
+}
+
+TEST_F(DispatcherTestReshaped, PointerResolvesSharedReference) {
+  EXPECT_CALL(mock_container, resolve()).WillOnce(ReturnRef(requested));
+
+  auto* result =
+      sut.template resolve<Requested*>(reshaping_container, config, nullptr);
+
+  ASSERT_EQ(result, &requested);
+}
+
+TEST_F(DispatcherTestReshaped, ConstPointerResolvesSharedReference) {
+  EXPECT_CALL(mock_container, resolve()).WillOnce(ReturnRef(requested));
+
+  auto* result = sut.template resolve<const Requested*>(reshaping_container,
+                                                        config, nullptr);
+
+  ASSERT_EQ(result, &requested);
+}
+
 }  // namespace
 }  // namespace dink
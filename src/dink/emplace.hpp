@@ -0,0 +1,155 @@
+// \file
+// Copyright (c) 2025 Frank Secilia
+// SPDX-License-Identifier: MIT
+//
+// \brief Resolves values directly into caller-provided storage.
+//
+// Value requests flow through the whole resolution chain as prvalues, so
+// guaranteed copy elision lets the final constructor call initialize the
+// destination object directly. The functions here expose that to callers that
+// own the storage: raw addresses, std::optional, or allocator-backed
+// unique_ptrs.
+//
+// resolve_at() and resolve_unique() initialize from the prvalue itself, so no
+// intermediate temporary is created, and non-movable types are supported.
+// std::optional can only be initialized through its own emplace(), which does
+// not guarantee that, so resolve_into() requires movable types.
+
+#pragma once
+
+#include <dink/lib.hpp>
+#include <dink/emplacer.hpp>
+#include <dink/meta.hpp>
+#include <concepts>
+#include <memory>
+#include <new>
+#include <optional>
+#include <type_traits>
+#include <utility>
+
+namespace dink {
+
+//! Identifies types that can be resolved into storage.
+//
+// Only cv-unqualified object types can be placed; references and pointers
+// refer to storage owned elsewhere.
+template <typename Requested>
+concept IsEmplaceable =
+    std::is_object_v<Requested> && !std::is_const_v<Requested> &&
+    !std::is_volatile_v<Requested> && !std::is_array_v<Requested>;
+
+// ----------------------------------------------------------------------------
+// Raw Storage
+// ----------------------------------------------------------------------------
+
+//! Resolves Requested into uninitialized storage at address.
+//
+// address must be suitably sized and aligned for Requested. The caller owns
+// the resulting object and is responsible for destroying it.
+//
+// \return pointer to the constructed object
+template <IsEmplaceable Requested, typename Container>
+auto resolve_at(Container& container, void* address) -> Requested* {
+  return ::new (address) Requested(container.template resolve<Requested>());
+}
+
+// ----------------------------------------------------------------------------
+// std::optional
+// ----------------------------------------------------------------------------
+
+//! Resolves Requested into optional, destroying any previous value.
+//
+// std::optional direct-initializes its value, so Requested must be movable,
+// and the resolved value may be moved into place. Non-movable types can be
+// resolved with resolve_at() or resolve_unique() instead.
+//
+// \return reference to the contained value
+template <IsEmplaceable Requested, typename Container>
+  requires(std::move_constructible<Requested>)
+auto resolve_into(Container& container, std::optional<Requested>& optional)
+    -> Requested& {
+  return optional.emplace(Emplacer<Requested, Container>{container});
+}
+
+// ----------------------------------------------------------------------------
+// Allocator-backed unique_ptr
+// ----------------------------------------------------------------------------
+
+namespace emplace::detail {
+
+//! true if Allocator customizes construction of Requested from Source.
+template <typename Allocator, typename Requested, typename Source>
+concept HasConstruct = requires(Allocator& allocator, Requested* instance,
+                                Source&& source) {
+  allocator.construct(instance, std::forward<Source>(source));
+};
+
+}  // namespace emplace::detail
+
+//! Destroys and deallocates using a stored allocator.
+//
+// \tparam Allocator allocator rebound to the element type
+template <typename Allocator>
+class AllocatorDeleter {
+ public:
+  using AllocatorTraits = std::allocator_traits<Allocator>;
+  using pointer = typename AllocatorTraits::pointer;
+
+  auto operator()(pointer instance) noexcept -> void {
+    AllocatorTraits::destroy(allocator_, std::to_address(instance));
+    AllocatorTraits::deallocate(allocator_, instance, 1);
+  }
+
+  explicit constexpr AllocatorDeleter(Allocator allocator) noexcept
+      : allocator_{std::move(allocator)} {}
+
+ private:
+  [[dink_no_unique_address]] Allocator allocator_;
+};
+
+//! unique_ptr owning an instance allocated from Allocator.
+template <typename Requested, typename Allocator>
+using AllocatedUniquePtr = std::unique_ptr<
+    Requested,
+    AllocatorDeleter<typename std::allocator_traits<
+        Allocator>::template rebind_alloc<Requested>>>;
+
+//! Resolves Requested into storage obtained from allocator.
+//
+// The instance is destroyed and its storage released by the returned pointer's
+// deleter, using a copy of allocator. If resolution throws, the storage is
+// released before the exception propagates.
+//
+// Allocators that customize construct() are passed an Emplacer for Requested,
+// so their construct() and destroy() stay paired. Those direct-initialize, so
+// Requested must be movable there. Otherwise, construct() would just construct
+// in place, so Requested is initialized from the resolved prvalue directly.
+template <IsEmplaceable Requested, typename Container, typename Allocator>
+auto resolve_unique(Container& container, const Allocator& allocator)
+    -> AllocatedUniquePtr<Requested, Allocator> {
+  using ReboundAllocator = typename std::allocator_traits<
+      Allocator>::template rebind_alloc<Requested>;
+  using AllocatorTraits = std::allocator_traits<ReboundAllocator>;
+
+  auto rebound_allocator = ReboundAllocator{allocator};
+  auto storage = AllocatorTraits::allocate(rebound_allocator, 1);
+  try {
+    using Source = Emplacer<Requested, Container>;
+    if constexpr (emplace::detail::HasConstruct<ReboundAllocator, Requested,
+                                                Source>) {
+      AllocatorTraits::construct(rebound_allocator, std::to_address(storage),
+                                 emplacer<Requested>(container));
+    } else {
+      resolve_at<Requested>(container, std::to_address(storage));
+    }
+  } catch (...) {
+    AllocatorTraits::deallocate(rebound_allocator, storage, 1);
+    throw;
+  }
+
+  return AllocatedUniquePtr<Requested, Allocator>{
+      storage,
+      AllocatorDeleter<ReboundAllocator>{std::move(rebound_allocator)}};
+}
+
+}  // namespace dink
@@ -0,0 +1,209 @@
+// \file
+// Copyright (c) 2025 Frank Secilia
+// SPDX-License-Identifier: MIT
+
+#include "emplace.hpp"
+#include <dink/test.hpp>
+#include <cstddef>
+#include <stdexcept>
+
+namespace dink {
+namespace {
+
+struct EmplaceTest : Test {
+  static constexpr auto kInitialValue = int_t{9137};  // Arbitrary.
+
+  // Neither copyable nor movable; only construction in place works.
+  struct Pinned {
+    int_t value;
+
+    explicit Pinned(int_t value) noexcept : value{value} {}
+    Pinned(const Pinned&) = delete;
+    auto operator=(const Pinned&) -> Pinned& = delete;
+  };
+
+  // Movable, so it can be resolved into an optional.
+  struct Movable {
+    int_t value;
+
+    explicit Movable(int_t value) noexcept : value{value} {}
+  };
+
+  // Returns prvalues, like the real resolution chain.
+  struct Container {
+    int_t num_resolves = 0;
+    bool throws = false;
+
+    template <typename Requested>
+    auto resolve() -> Requested {
+      ++num_resolves;
+      if (throws) throw std::runtime_error{"resolve failed"};
+      return Requested{kInitialValue};
+    }
+  };
+  Container container;
+
+  // Allocator that counts live allocations.
+  template <typename Value>
+  struct CountingAllocator {
+    using value_type = Value;
+
+    int_t* num_allocations;
+
+    auto allocate(std::size_t size) -> Value* {
+      ++*num_allocations;
+      return std::allocator<Value>{}.allocate(size);
+    }
+
+    auto deallocate(Value* instance, std::size_t size) noexcept -> void {
+      --*num_allocations;
+      std::allocator<Value>{}.deallocate(instance, size);
+    }
+
+    explicit CountingAllocator(int_t* num_allocations) noexcept
+        : num_allocations{num_allocations} {}
+
+    template <typename Other>
+    explicit CountingAllocator(const CountingAllocator<Other>& src) noexcept
+        : num_allocations{src.num_allocations} {}
+  };
+  int_t num_allocations = 0;
+
+  // Allocator that customizes construction and destruction.
+  template <typename Value>
+  struct ConstructingAllocator : CountingAllocator<Value> {
+    using value_type = Value;
+
+    int_t* num_constructs;
+
+    template <typename Source>
+    auto construct(Value* instance, Source&& source) -> void {
+      ++*num_constructs;
+      ::new (static_cast<void*>(instance)) Value(std::forward<Source>(source));
+    }
+
+    auto destroy(Value* instance) noexcept -> void {
+      --*num_constructs;
+      instance->~Value();
+    }
+
+    ConstructingAllocator(int_t* num_allocations,
+                          int_t* num_constructs) noexcept
+        : CountingAllocator<Value>{num_allocations},
+          num_constructs{num_constructs} {}
+
+    template <typename Other>
+    explicit ConstructingAllocator(
+        const ConstructingAllocator<Other>& src) noexcept
+        : CountingAllocator<Value>{src},
+          num_constructs{src.num_constructs} {}
+  };
+  int_t num_constructs = 0;
+};
+
+static_assert(IsEmplaceable<int_t>);
+static_assert(IsEmplaceable<EmplaceTest::Pinned>);
+static_assert(!IsEmplaceable<int_t&>);
+static_assert(!IsEmplaceable<const int_t>);
+static_assert(!IsEmplaceable<int_t[2]>);
+
+template <typename Requested>
+concept ResolvableIntoOptional = requires(EmplaceTest::Container& container,
+                                          std::optional<Requested>& optional) {
+  resolve_into(container, optional);
+};
+static_assert(ResolvableIntoOptional<EmplaceTest::Movable>);
+static_assert(!ResolvableIntoOptional<EmplaceTest::Pinned>,
+              "optional cannot portably construct non-movable types in place");
+
+// ----------------------------------------------------------------------------
+// Emplacer
+// ----------------------------------------------------------------------------
+
+TEST_F(EmplaceTest, emplacer_defers_resolution_until_conversion) {
+  auto sut = emplacer<Pinned>(container);
+  ASSERT_EQ(0, container.num_resolves);
+
+  const Pinned result = sut;
+
+  ASSERT_EQ(1, container.num_resolves);
+  ASSERT_EQ(kInitialValue, result.value);
+}
+
+// ----------------------------------------------------------------------------
+// resolve_at
+// ----------------------------------------------------------------------------
+
+TEST_F(EmplaceTest, resolve_at_constructs_at_address) {
+  alignas(Pinned) std::byte storage[sizeof(Pinned)];
+
+  auto* const result = resolve_at<Pinned>(container, storage);
+
+  ASSERT_EQ(static_cast<void*>(storage), static_cast<void*>(result));
+  ASSERT_EQ(kInitialValue, result->value);
+  std::destroy_at(result);
+}
+
+// ----------------------------------------------------------------------------
+// resolve_into
+// ----------------------------------------------------------------------------
+
+TEST_F(EmplaceTest, resolve_into_engages_optional) {
+  auto optional = std::optional<Movable>{};
+
+  auto& result = resolve_into(container, optional);
+
+  ASSERT_TRUE(optional.has_value());
+  ASSERT_EQ(&*optional, &result);
+  ASSERT_EQ(kInitialValue, result.value);
+}
+
+TEST_F(EmplaceTest, resolve_into_replaces_engaged_optional) {
+  auto optional = std::optional<Movable>{std::in_place, int_t{0}};
+
+  resolve_into(container, optional);
+
+  ASSERT_EQ(kInitialValue, optional->value);
+}
+
+// ----------------------------------------------------------------------------
+// resolve_unique
+// ----------------------------------------------------------------------------
+
+TEST_F(EmplaceTest, resolve_unique_allocates_from_allocator) {
+  {
+    auto result = resolve_unique<Pinned>(
+        container, CountingAllocator<std::byte>{&num_allocations});
+
+    ASSERT_EQ(1, num_allocations);
+    ASSERT_EQ(kInitialValue, result->value);
+  }
+  ASSERT_EQ(0, num_allocations);
+}
+
+TEST_F(EmplaceTest, resolve_unique_pairs_allocator_construct_and_destroy) {
+  {
+    auto result = resolve_unique<Movable>(
+        container,
+        ConstructingAllocator<std::byte>{&num_allocations, &num_constructs});
+
+    ASSERT_EQ(1, num_allocations);
+    ASSERT_EQ(1, num_constructs);
+    ASSERT_EQ(kInitialValue, result->value);
+  }
+  ASSERT_EQ(0, num_allocations);
+  ASSERT_EQ(0, num_constructs);
+}
+
+TEST_F(EmplaceTest, resolve_unique_releases_storage_when_resolve_throws) {
+  container.throws = true;
+
+  EXPECT_THROW(resolve_unique<Pinned>(
+                   container, CountingAllocator<std::byte>{&num_allocations}),
+               std::runtime_error);
+
+  ASSERT_EQ(0, num_allocations);
+}
+
+}  // namespace
+}  // namespace dink
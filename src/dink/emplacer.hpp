@@ -0,0 +1,53 @@
+// \file
+// Copyright (c) 2025 Frank Secilia
+// SPDX-License-Identifier: MIT
+//
+// \brief Defines Emplacer, which resolves when converted.
+//
+// This is split from emplace.hpp so the container can build resolved tuples
+// without including std::optional and the allocator support there.
+
+#pragma once
+
+#include <dink/lib.hpp>
+#include <dink/meta.hpp>
+
+namespace dink {
+
+//! Deferred resolution, convertible to Requested.
+//
+// Emplacer is passed to emplace-style apis, like std::optional::emplace or
+// std::vector::emplace_back, in place of constructor arguments. The container
+// call happens inside the conversion operator.
+//
+// Copy-initializing from an Emplacer, including as an aggregate member,
+// initializes the destination directly from the resolved prvalue. Emplace-style
+// apis direct-initialize instead, which selects the destination's move ctor.
+// Some compilers elide that move through the conversion operator (CWG2327),
+// but it isn't guaranteed, so the destination must be movable there.
+//
+// Unlike Resolver, Emplacer converts only to the exact requested form, so it
+// never matches unrelated constructors of the destination type.
+template <typename Requested, typename Container>
+class Emplacer {
+ public:
+  //! Resolves Requested from the container.
+  constexpr operator meta::RemoveRvalueRef<Requested>() const {
+    return container_.template resolve<Requested>();
+  }
+
+  explicit constexpr Emplacer(Container& container) noexcept
+      : container_{container} {}
+
+ private:
+  Container& container_;
+};
+
+//! Creates an Emplacer for Requested backed by container.
+template <typename Requested, typename Container>
+constexpr auto emplacer(Container& container) noexcept
+    -> Emplacer<Requested, Container> {
+  return Emplacer<Requested, Container>{container};
+}
+
+}  // namespace dink
@@ -0,0 +1,82 @@
+// \file
+// Copyright (c) 2025 Frank Secilia
+// SPDX-License-Identifier: MIT
+//
+// \brief Forward declarations of dink's public types.
+//
+// Interface headers can name these types, e.g. to declare a constructor taking
+// Lazy<Db, App> or Provider<Request, App>, without including their
+// definitions:
+//
+//   #include <dink/fwd.hpp>
+//
+//   class Handler {
+//    public:
+//     explicit Handler(dink::Lazy<Db, dink::AnyContainer> db);
+//   };
+//
+// Default template arguments are declared here, so the defining headers
+// include this one rather than repeat them.
+//
+// Container and the ctor and factory providers are not declared here. Their
+// parameters are constrained by, or default to, types in the full headers.
+
+#pragma once
+
+#include <dink/lib.hpp>
+#include <cstddef>
+
+namespace dink {
+
+struct AnyContainer;
+
+template <typename From, typename Scope, typename Provider>
+struct Binding;
+
+template <typename... Bindings>
+class Config;
+
+template <typename Requested, typename Container>
+class Lazy;
+
+template <typename Qualifier, typename Type>
+struct NamedKey;
+
+template <typename Qualifier, typename Requested>
+class Named;
+
+template <typename Element>
+struct SetOf;
+
+template <typename Requested, typename Container>
+class Provider;
+
+template <typename Signature, typename Container>
+class AssistedFactory;
+
+template <typename Interface, std::size_t capacity,
+          std::size_t alignment = alignof(std::max_align_t)>
+class InlinePoly;
+
+namespace cache {
+class Type;
+class Instance;
+}  // namespace cache
+
+namespace provider {
+template <typename Instance>
+class External;
+}  // namespace provider
+
+namespace tree {
+class Deleter;
+}  // namespace tree
+
+namespace scope {
+class Transient;
+class Singleton;
+class Instance;
+class PerGraph;
+}  // namespace scope
+
+}  // namespace dink
@@ -0,0 +1,32 @@
+// \file
+// Copyright (c) 2025 Frank Secilia
+// SPDX-License-Identifier: MIT
+
+#include "fwd.hpp"
+#include <dink/test.hpp>
+#include <dink/assisted_factory.hpp>
+#include <dink/binding.hpp>
+#include <dink/cache.hpp>
+#include <dink/config.hpp>
+#include <dink/inline_poly.hpp>
+#include <dink/lazy.hpp>
+#include <dink/multibinding.hpp>
+#include <dink/named.hpp>
+#include <dink/provider.hpp>
+#include <dink/provider_handle.hpp>
+#include <dink/scope.hpp>
+#include <concepts>
+#include <cstddef>
+
+namespace dink {
+namespace {
+
+struct Requested {};
+
+// The definitions redeclare every forward declaration, and the default
+// template arguments declared in fwd.hpp apply to them.
+static_assert(std::same_as<InlinePoly<Requested, 8>,
+                           InlinePoly<Requested, 8, alignof(std::max_align_t)>>);
+
+}  // namespace
+}  // namespace dink
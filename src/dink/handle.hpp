@@ -0,0 +1,47 @@
+// \file
+// Copyright (c) 2025 Frank Secilia
+// SPDX-License-Identifier: MIT
+//
+// \brief Identifies injectable handles that are bound to a container.
+//
+// Handles, like Lazy or Provider, are not created from a binding. They are
+// constructed directly from the container that requests them and resolve
+// through it later. The trait is specialized by each handle's header.
+
+#pragma once
+
+#include <dink/lib.hpp>
+#include <type_traits>
+
+namespace dink {
+
+//! Container argument that lets a handle be created from any container.
+//
+// Handles are parameterized on the container they resolve from, so resolving
+// through them is a direct, inlinable call. A consumer that can't name its
+// container's type names AnyContainer instead, which opts into type erasure:
+// the handle holds an untyped pointer alongside a function pointer
+// instantiated for the concrete container type, and resolves through the
+// function pointer. That costs a pointer of storage and an indirect call.
+//
+// Either way, there is no virtual dispatch and no allocation.
+struct AnyContainer {};
+
+namespace traits {
+
+template <typename>
+struct IsHandle : std::false_type {};
+
+template <typename Type>
+inline constexpr auto is_handle = IsHandle<Type>::value;
+
+}  // namespace traits
+
+//! Matches handle types, ignoring cv and ref qualifiers.
+//
+// This concept uses an extensible template that can be specialized for
+// arbitrary types.
+template <typename Type>
+concept IsHandle = traits::is_handle<std::remove_cvref_t<Type>>;
+
+}  // namespace dink
@@ -0,0 +1,192 @@
+// \file
+// Copyright (c) 2025 Frank Secilia
+// SPDX-License-Identifier: MIT
+//
+// \brief Explicit declaration of the constructor used for injection.
+//
+// By default, provider::Ctor deduces which constructor to call by probing
+// arities, which costs compile time and picks the greediest constructor. A type
+// may instead declare its injection constructor as a function type, either with
+// a member alias:
+//
+//   struct Widget {
+//     using dink_inject = Widget(Logger&, std::shared_ptr<Db>, Config);
+//     Widget(Logger&, std::shared_ptr<Db>, Config);
+//   };
+//
+// or, for types that can't be modified, by specializing InjectTraits:
+//
+//   template <>
+//   struct dink::InjectTraits<Widget> {
+//     using Signature = Widget(Logger&, std::shared_ptr<Db>, Config);
+//   };
+//
+// The signature must return the declaring type itself, so a derived class must
+// declare its own rather than inherit its base's. Each parameter is
+// resolved from the container as exactly that type, so overloaded constructors
+// of the same arity are selected deterministically, and the arity is not
+// limited by dink_max_deduced_arity. A specialization of InjectTraits takes
+// precedence over the member alias.
+//
+// Aggregates may instead declare which fields to inject, by member pointer:
+//
+//   struct ServerConfig {
+//     std::shared_ptr<Db> db;
+//     int_t port = 8080;
+//     Logger* logger;
+//     using dink_inject = InjectFields<&ServerConfig::db, &ServerConfig::logger>;
+//   };
+//
+// Each listed field is initialized with an instance resolved as the field's
+// type, and fields not listed keep their default member initializers. Listed
+// fields must be declared by the aggregate itself, and since they are named by
+// member pointer, they cannot be references. If an unlisted field precedes a
+// listed one, as port does here, the aggregate must be value-initializable.
+
+#pragma once
+
+#include <dink/lib.hpp>
+#include <dink/meta.hpp>
+#include <dink/type_list.hpp>
+#include <concepts>
+#include <cstddef>
+#include <type_traits>
+
+namespace dink {
+
+//! Customization point declaring Constructed's injection constructor.
+//
+// Specializations define Signature as a function type whose parameters are the
+// injection constructor's parameters, or as InjectFields.
+template <typename Constructed>
+struct InjectTraits {};
+
+//! Injection declaration assigning resolved instances to aggregate fields.
+//
+// \tparam fields pointers to the data members to inject, in injection order
+template <auto... fields>
+struct InjectFields {};
+
+namespace detail::inject {
+
+//! Checks that a declared constructor signature constructs Constructed.
+//
+// The member alias is inherited, so without this, a derived class would be
+// silently built from its base's signature.
+template <typename Constructed, typename Declared>
+struct CheckedSignature {
+  using type = Declared;
+};
+
+template <typename Constructed, typename Return, typename... Params>
+struct CheckedSignature<Constructed, Return(Params...)> {
+  static_assert(std::same_as<Return, Constructed>,
+                "Injection signature must return the type it constructs. A "
+                "derived class inherits its base's dink_inject; declare its "
+                "own.");
+  using type = Return(Params...);
+};
+
+//! Finds the signature declared by a member alias.
+template <typename Constructed>
+struct MemberSignature {};
+
+template <typename Constructed>
+  requires requires { typename Constructed::dink_inject; }
+struct MemberSignature<Constructed>
+    : CheckedSignature<Constructed, typename Constructed::dink_inject> {};
+
+//! Finds the declared signature, preferring InjectTraits to the member alias.
+template <typename Constructed>
+struct Signature : MemberSignature<Constructed> {};
+
+template <typename Constructed>
+  requires requires { typename InjectTraits<Constructed>::Signature; }
+struct Signature<Constructed>
+    : CheckedSignature<Constructed,
+                       typename InjectTraits<Constructed>::Signature> {};
+
+}  // namespace detail::inject
+
+//! true if Constructed declares its injection constructor.
+template <typename Constructed>
+concept DeclaresInjection =
+    requires { typename detail::inject::Signature<Constructed>::type; };
+
+//! Declared injection constructor signature of Constructed.
+template <DeclaresInjection Constructed>
+using InjectSignature = typename detail::inject::Signature<Constructed>::type;
+
+namespace detail::inject {
+
+template <typename Signature>
+struct Arity {
+  static_assert(meta::kDependentFalse<Signature>,
+                "Injection signature must be a function type, e.g. T(A&, B), "
+                "or InjectFields.");
+};
+
+template <typename Return, typename... Params>
+struct Arity<Return(Params...)> {
+  static constexpr auto value = sizeof...(Params);
+};
+
+template <auto... fields>
+struct Arity<InjectFields<fields...>> {
+  static constexpr auto value = sizeof...(fields);
+};
+
+template <typename Signature>
+struct IsInjectFields : std::false_type {};
+
+template <auto... fields>
+struct IsInjectFields<InjectFields<fields...>> : std::true_type {};
+
+//! Lists the requests a declared signature resolves.
+template <typename Signature>
+struct DeclaredRequests {
+  using type = TypeList<>;
+};
+
+template <typename Return, typename... Params>
+struct DeclaredRequests<Return(Params...)> {
+  using type = TypeList<Params...>;
+};
+
+template <auto... fields>
+struct DeclaredRequests<InjectFields<fields...>> {
+  using type = TypeList<meta::MemberType<fields>...>;
+};
+
+template <typename Constructed>
+struct Dependencies {
+  using type = TypeList<>;
+};
+
+template <DeclaresInjection Constructed>
+struct Dependencies<Constructed> {
+  using type = typename DeclaredRequests<InjectSignature<Constructed>>::type;
+};
+
+}  // namespace detail::inject
+
+//! Requests resolved to construct Constructed, in injection order.
+//
+// These are only known for types that declare their injection. For other
+// types, this is empty.
+template <typename Constructed>
+using InjectDependencies =
+    typename detail::inject::Dependencies<Constructed>::type;
+
+//! Number of parameters in Constructed's declared injection constructor.
+template <DeclaresInjection Constructed>
+inline constexpr std::size_t inject_arity =
+    detail::inject::Arity<InjectSignature<Constructed>>::value;
+
+//! true if Constructed declares fields to inject rather than a ctor.
+template <typename Constructed>
+concept DeclaresInjectedFields =
+    DeclaresInjection<Constructed> &&
+    detail::inject::IsInjectFields<InjectSignature<Constructed>>::value;
+
+}  // namespace dink
@@ -0,0 +1,31 @@
+// \file
+// Copyright (c) 2025 Frank Secilia
+// SPDX-License-Identifier: MIT
+//
+// Must fail to compile, since Derived inherits Base's dink_inject.
+//
+// Built on demand by the dink_inject_compile_error test.
+
+#include <dink/container.hpp>
+
+namespace dink {
+namespace {
+
+struct Dependency {};
+
+struct Base {
+  using dink_inject = Base(Dependency);
+  explicit Base(Dependency) noexcept {}
+};
+
+struct Derived : Base {
+  using Base::Base;
+};
+
+[[maybe_unused]] auto resolve_derived() -> void {
+  auto container = Container{};
+  container.resolve<Derived>();
+}
+
+}  // namespace
+}  // namespace dink
@@ -0,0 +1,119 @@
+// \file
+// Copyright (c) 2025 Frank Secilia
+// SPDX-License-Identifier: MIT
+
+#include "inject.hpp"
+#include <dink/test.hpp>
+#include <concepts>
+#include <memory>
+
+namespace dink {
+namespace {
+
+struct A {};
+struct B {};
+
+struct Undeclared {
+  Undeclared(A&, B);
+};
+
+struct MemberDeclared {
+  using dink_inject = MemberDeclared(A&, std::shared_ptr<B>);
+  MemberDeclared(A&, std::shared_ptr<B>);
+};
+
+struct TraitsDeclared {
+  TraitsDeclared(const A&);
+};
+
+struct BothDeclared {
+  using dink_inject = BothDeclared(A, B);
+  BothDeclared(A, B);
+  explicit BothDeclared(B);
+};
+
+struct NoParams {
+  using dink_inject = NoParams();
+};
+
+// Redeclares rather than inherits the base's signature.
+struct DerivedDeclared : MemberDeclared {
+  using dink_inject = DerivedDeclared(A&);
+  explicit DerivedDeclared(A&);
+};
+
+struct FieldsDeclared {
+  A a;
+  int_t value = 3;
+  std::shared_ptr<B> b;
+  using dink_inject = InjectFields<&FieldsDeclared::a, &FieldsDeclared::b>;
+};
+
+}  // namespace
+
+template <>
+struct InjectTraits<TraitsDeclared> {
+  using Signature = TraitsDeclared(const A&);
+};
+
+template <>
+struct InjectTraits<BothDeclared> {
+  using Signature = BothDeclared(B);
+};
+
+namespace {
+
+/*
+  Detection
+  -----------------------------------------------------------------------------
+*/
+static_assert(!DeclaresInjection<Undeclared>);
+static_assert(DeclaresInjection<MemberDeclared>);
+static_assert(DeclaresInjection<TraitsDeclared>);
+static_assert(DeclaresInjection<BothDeclared>);
+static_assert(DeclaresInjection<NoParams>);
+static_assert(DeclaresInjection<FieldsDeclared>);
+
+static_assert(!DeclaresInjectedFields<Undeclared>);
+static_assert(!DeclaresInjectedFields<MemberDeclared>);
+static_assert(DeclaresInjectedFields<FieldsDeclared>);
+
+/*
+  Signature
+  -----------------------------------------------------------------------------
+*/
+static_assert(std::same_as<MemberDeclared(A&, std::shared_ptr<B>),
+                           InjectSignature<MemberDeclared>>);
+static_assert(
+    std::same_as<TraitsDeclared(const A&), InjectSignature<TraitsDeclared>>);
+
+static_assert(
+    std::same_as<DerivedDeclared(A&), InjectSignature<DerivedDeclared>>);
+
+// InjectTraits takes precedence over the member alias.
+static_assert(std::same_as<BothDeclared(B), InjectSignature<BothDeclared>>);
+
+/*
+  Arity
+  -----------------------------------------------------------------------------
+*/
+static_assert(inject_arity<MemberDeclared> == 2);
+static_assert(inject_arity<TraitsDeclared> == 1);
+static_assert(inject_arity<BothDeclared> == 1);
+static_assert(inject_arity<NoParams> == 0);
+static_assert(inject_arity<FieldsDeclared> == 2);
+
+/*
+  Dependencies
+  -----------------------------------------------------------------------------
+*/
+static_assert(std::same_as<TypeList<>, InjectDependencies<Undeclared>>);
+static_assert(std::same_as<TypeList<A&, std::shared_ptr<B>>,
+                           InjectDependencies<MemberDeclared>>);
+static_assert(std::same_as<TypeList<B>, InjectDependencies<BothDeclared>>);
+static_assert(std::same_as<TypeList<>, InjectDependencies<NoParams>>);
+static_assert(std::same_as<TypeList<A, std::shared_ptr<B>>,
+                           InjectDependencies<FieldsDeclared>>);
+
+}  // namespace
+}  // namespace dink
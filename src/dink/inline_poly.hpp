@@ -0,0 +1,176 @@
+// \file
+// Copyright (c) 2025 Frank Secilia
+// SPDX-License-Identifier: MIT
+//
+// \brief Owning polymorphic holder with inline storage for small instances.
+//
+// Resolving an interface bound to an implementation, like
+// bind<Logger>().as<FileLogger>(), as a unique_ptr allocates each instance on
+// the heap. Resolving it as an InlinePoly instead constructs the
+// implementation in the holder's own buffer when it fits:
+//
+//   auto logger = container.resolve<InlinePoly<Logger, 64>>();
+//   logger->log("...");
+//
+// Implementations that are too large, overaligned, or not nothrow movable are
+// allocated on the heap instead, so every binding resolves either way.
+// InlinePoly is requested wherever unique_ptr is, and resolves through the same
+// bindings and scopes.
+
+#pragma once
+
+#include <dink/lib.hpp>
+#include <dink/fwd.hpp>
+#include <cstddef>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+namespace dink {
+
+namespace inline_poly::detail {
+
+//! Type-erased operations on an implementation of Interface.
+template <typename Interface>
+struct Ops {
+  //! Destroys the implementation at object, and frees it if on the heap.
+  void (*destroy)(void* object) noexcept;
+
+  //! Moves the implementation at from into storage at to, destroying from.
+  //
+  // Null for implementations stored on the heap, which are never moved.
+  auto (*relocate)(void* from, void* to) noexcept -> Interface*;
+};
+
+template <typename Impl>
+auto destroy_inline(void* object) noexcept -> void {
+  static_cast<Impl*>(object)->~Impl();
+}
+
+template <typename Impl>
+auto destroy_on_heap(void* object) noexcept -> void {
+  delete static_cast<Impl*>(object);
+}
+
+template <typename Interface, typename Impl>
+auto relocate(void* from, void* to) noexcept -> Interface* {
+  auto* const source = static_cast<Impl*>(from);
+  auto* const impl = ::new (to) Impl(std::move(*source));
+  source->~Impl();
+  return impl;
+}
+
+template <typename Interface, typename Impl, bool stored_inline>
+constexpr auto make_ops() noexcept -> Ops<Interface> {
+  if constexpr (stored_inline) {
+    return {&destroy_inline<Impl>, &relocate<Interface, Impl>};
+  } else {
+    return {&destroy_on_heap<Impl>, nullptr};
+  }
+}
+
+template <typename Interface, typename Impl, bool stored_inline>
+inline constexpr auto ops = make_ops<Interface, Impl, stored_inline>();
+
+}  // namespace inline_poly::detail
+
+//! Owns an implementation of Interface, stored inline when it fits.
+//
+// \tparam capacity size of the inline buffer, in bytes
+// \tparam alignment alignment of the inline buffer
+template <typename Interface, std::size_t capacity, std::size_t alignment>
+class InlinePoly {
+  static_assert(capacity > 0, "InlinePoly: capacity must be nonzero.");
+
+ public:
+  using element_type = Interface;
+
+  //! true if Impl is constructed in the inline buffer.
+  //
+  // Inline implementations are moved along with the holder, so they must be
+  // nothrow movable for the holder to be.
+  template <typename Impl>
+  static constexpr auto fits_inline =
+      sizeof(Impl) <= capacity && alignof(Impl) <= alignment &&
+      std::is_nothrow_move_constructible_v<Impl>;
+
+  //! Constructs an Impl from args, inline if it fits.
+  //
+  // This only throws if Impl's ctor does, or if Impl is allocated.
+  template <typename Impl, typename... Args>
+  explicit InlinePoly(std::in_place_type_t<Impl>, Args&&... args) noexcept(
+      fits_inline<Impl> && std::is_nothrow_constructible_v<Impl, Args...>)
+      : ops_{&inline_poly::detail::ops<Interface, Impl, fits_inline<Impl>>} {
+    static_assert(std::is_convertible_v<Impl*, Interface*>,
+                  "InlinePoly: Impl must derive from Interface.");
+
+    Impl* impl;
+    if constexpr (fits_inline<Impl>) {
+      impl = ::new (static_cast<void*>(storage_))
+          Impl(std::forward<Args>(args)...);
+    } else {
+      impl = new Impl(std::forward<Args>(args)...);
+    }
+    object_ = impl;
+    instance_ = impl;
+  }
+
+  //! Constructs empty.
+  InlinePoly() noexcept = default;
+
+  InlinePoly(InlinePoly&& src) noexcept { take(src); }
+
+  auto operator=(InlinePoly&& src) noexcept -> InlinePoly& {
+    if (this != &src) {
+      reset();
+      take(src);
+    }
+    return *this;
+  }
+
+  InlinePoly(const InlinePoly&) = delete;
+  auto operator=(const InlinePoly&) -> InlinePoly& = delete;
+
+  ~InlinePoly() { reset(); }
+
+  //! Destroys the instance, leaving this empty.
+  auto reset() noexcept -> void {
+    if (!instance_) return;
+    ops_->destroy(object_);
+    object_ = nullptr;
+    instance_ = nullptr;
+    ops_ = nullptr;
+  }
+
+  //! true if the instance is stored in the inline buffer.
+  auto is_inline() const noexcept -> bool { return object_ == storage_; }
+
+  auto get() const noexcept -> Interface* { return instance_; }
+  auto operator*() const noexcept -> Interface& { return *instance_; }
+  auto operator->() const noexcept -> Interface* { return instance_; }
+  explicit operator bool() const noexcept { return instance_ != nullptr; }
+
+ private:
+  //! Takes src's instance, relocating it if inline, and leaves src empty.
+  auto take(InlinePoly& src) noexcept -> void {
+    if (!src.instance_) return;
+    ops_ = src.ops_;
+    if (src.is_inline()) {
+      instance_ = ops_->relocate(src.storage_, storage_);
+      object_ = storage_;
+    } else {
+      instance_ = src.instance_;
+      object_ = src.object_;
+    }
+    src.object_ = nullptr;
+    src.instance_ = nullptr;
+    src.ops_ = nullptr;
+  }
+
+  alignas(alignment) std::byte storage_[capacity];
+  void* object_ = nullptr;
+  Interface* instance_ = nullptr;
+  const inline_poly::detail::Ops<Interface>* ops_ = nullptr;
+};
+
+}  // namespace dink
@@ -0,0 +1,192 @@
+// \file
+// Copyright (c) 2025 Frank Secilia
+// SPDX-License-Identifier: MIT
+
+#include "inline_poly.hpp"
+#include <dink/test.hpp>
+#include <dink/binding_dsl.hpp>
+#include <dink/container.hpp>
+#include <cstddef>
+#include <utility>
+
+namespace dink {
+namespace {
+
+struct InlinePolyTest : Test {
+  static constexpr auto kValue = int_t{7219};  // Arbitrary.
+  static constexpr auto kCapacity = std::size_t{64};
+
+  static inline int_t num_destroyed = 0;
+
+  struct Interface {
+    virtual ~Interface() { ++num_destroyed; }
+    virtual auto value() const noexcept -> int_t = 0;
+  };
+
+  struct Dependency {
+    using dink_inject = Dependency();
+    int_t value = kValue;
+  };
+
+  struct Small : Interface {
+    explicit Small(Dependency dependency) noexcept
+        : dependency{dependency} {}
+    auto value() const noexcept -> int_t override { return dependency.value; }
+
+    Dependency dependency;
+  };
+
+  struct Large : Small {
+    using Small::Small;
+    std::byte padding[2 * kCapacity] = {};
+  };
+
+  // Fits, but can't be moved without risking a throw.
+  struct ThrowingMove : Small {
+    using Small::Small;
+    ThrowingMove(ThrowingMove&& src) noexcept(false) : Small{src.dependency} {}
+  };
+
+  using Poly = InlinePoly<Interface, kCapacity>;
+
+  struct Consumer {
+    using dink_inject = Consumer(Poly);
+    explicit Consumer(Poly poly) noexcept : poly{std::move(poly)} {}
+
+    Poly poly;
+  };
+
+  InlinePolyTest() { num_destroyed = 0; }
+};
+
+static_assert(InlinePolyTest::Poly::fits_inline<InlinePolyTest::Small>);
+static_assert(!InlinePolyTest::Poly::fits_inline<InlinePolyTest::Large>);
+static_assert(!InlinePolyTest::Poly::fits_inline<InlinePolyTest::ThrowingMove>);
+static_assert(std::is_nothrow_move_constructible_v<InlinePolyTest::Poly>);
+static_assert(!std::is_copy_constructible_v<InlinePolyTest::Poly>);
+
+// ----------------------------------------------------------------------------
+// InlinePoly
+// ----------------------------------------------------------------------------
+
+TEST_F(InlinePolyTest, default_is_empty) {
+  const auto sut = Poly{};
+
+  ASSERT_FALSE(sut);
+  ASSERT_EQ(nullptr, sut.get());
+}
+
+TEST_F(InlinePolyTest, small_impl_is_inline) {
+  const auto sut = Poly{std::in_place_type<Small>, Dependency{}};
+
+  ASSERT_TRUE(sut.is_inline());
+  ASSERT_EQ(kValue, sut->value());
+}
+
+TEST_F(InlinePolyTest, large_impl_is_on_heap) {
+  const auto sut = Poly{std::in_place_type<Large>, Dependency{}};
+
+  ASSERT_FALSE(sut.is_inline());
+  ASSERT_EQ(kValue, sut->value());
+}
+
+TEST_F(InlinePolyTest, throwing_move_impl_is_on_heap) {
+  const auto sut = Poly{std::in_place_type<ThrowingMove>, Dependency{}};
+
+  ASSERT_FALSE(sut.is_inline());
+}
+
+TEST_F(InlinePolyTest, move_relocates_inline_impl) {
+  auto src = Poly{std::in_place_type<Small>, Dependency{}};
+
+  const auto sut = std::move(src);
+
+  ASSERT_FALSE(src);
+  ASSERT_TRUE(sut.is_inline());
+  ASSERT_EQ(kValue, sut->value());
+  ASSERT_EQ(1, num_destroyed);
+}
+
+TEST_F(InlinePolyTest, move_transfers_heap_impl) {
+  auto src = Poly{std::in_place_type<Large>, Dependency{}};
+  const auto* const instance = src.get();
+
+  const auto sut = std::move(src);
+
+  ASSERT_FALSE(src);
+  ASSERT_EQ(instance, sut.get());
+  ASSERT_EQ(0, num_destroyed);
+}
+
+TEST_F(InlinePolyTest, move_assignment_destroys_previous_impl) {
+  auto sut = Poly{std::in_place_type<Small>, Dependency{}};
+
+  sut = Poly{std::in_place_type<Large>, Dependency{}};
+
+  ASSERT_EQ(1, num_destroyed);
+  ASSERT_FALSE(sut.is_inline());
+}
+
+TEST_F(InlinePolyTest, reset_destroys_impl) {
+  auto sut = Poly{std::in_place_type<Large>, Dependency{}};
+
+  sut.reset();
+
+  ASSERT_FALSE(sut);
+  ASSERT_EQ(1, num_destroyed);
+}
+
+// ----------------------------------------------------------------------------
+// Resolution
+// ----------------------------------------------------------------------------
+
+TEST_F(InlinePolyTest, resolves_bound_impl_inline) {
+  auto container = Container{bind<Interface>().as<Small>()};
+
+  const auto result = container.resolve<Poly>();
+
+  ASSERT_TRUE(result.is_inline());
+  ASSERT_EQ(kValue, result->value());
+}
+
+TEST_F(InlinePolyTest, resolves_large_bound_impl_on_heap) {
+  auto container = Container{bind<Interface>().as<Large>()};
+
+  const auto result = container.resolve<Poly>();
+
+  ASSERT_FALSE(result.is_inline());
+  ASSERT_EQ(kValue, result->value());
+}
+
+TEST_F(InlinePolyTest, resolves_factory_impl_inline) {
+  auto container = Container{bind<Interface>().as<Small>().via(
+      [](Dependency dependency) { return Small{dependency}; })};
+
+  const auto result = container.resolve<Poly>();
+
+  ASSERT_TRUE(result.is_inline());
+  ASSERT_EQ(kValue, result->value());
+}
+
+TEST_F(InlinePolyTest, resolves_copy_of_singleton) {
+  auto container = dink_unique_container(
+      bind<Interface>().as<Small>().in<scope::Singleton>());
+  auto& singleton = container.resolve<Interface&>();
+
+  const auto result = container.resolve<Poly>();
+
+  ASSERT_TRUE(result.is_inline());
+  ASSERT_NE(&singleton, result.get());
+}
+
+TEST_F(InlinePolyTest, injects_into_ctor) {
+  auto container = Container{bind<Interface>().as<Small>()};
+
+  const auto result = container.resolve<Consumer>();
+
+  ASSERT_TRUE(result.poly.is_inline());
+  ASSERT_EQ(kValue, result.poly->value());
+}
+
+}  // namespace
+}  // namespace dink
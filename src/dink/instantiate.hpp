@@ -0,0 +1,85 @@
+// \file
+// Copyright (c) 2025 Frank Secilia
+// SPDX-License-Identifier: MIT
+//
+// \brief Explicit instantiation of resolution paths across translation units.
+//
+// Every translation unit that calls container.resolve<T>() instantiates the
+// whole dispatcher, strategy, scope, provider, and invoker chain for T. These
+// macros move that work into one translation unit. A shared header declares
+// the container type and its resolution paths:
+//
+//   using AppContainer = decltype(Container{bind<Db>().in<scope::Singleton>()});
+//   dink_extern_resolve(AppContainer, Db&, Service, std::shared_ptr<Logger>);
+//
+// and exactly one .cpp defines them:
+//
+//   dink_instantiate_resolve(AppContainer, Db&, Service,
+//                            std::shared_ptr<Logger>);
+//
+// Consumers then only see declarations of the listed paths. Paths not listed
+// are still instantiated implicitly where they are used, including paths to
+// dependencies of listed types outside the instantiating .cpp.
+//
+// Both macros must be used at namespace scope. The container type must name
+// the same type in every translation unit, so it can't be created with
+// dink_unique_container(). Requested types containing commas, such as
+// std::map<K, V>, must be passed through an alias.
+
+#pragma once
+
+#include <dink/lib.hpp>
+#include <dink/container.hpp>
+#include <dink/meta.hpp>
+
+// clang-format off
+
+//! Declares resolve<Requested>() of Container as instantiated elsewhere.
+#define dink_extern_resolve(Container, ...) \
+  dink_detail_for_each_resolve(extern template, Container, __VA_ARGS__)
+
+//! Instantiates resolve<Requested>() of Container in this translation unit.
+#define dink_instantiate_resolve(Container, ...) \
+  dink_detail_for_each_resolve(template, Container, __VA_ARGS__)
+
+// ----------------------------------------------------------------------------
+// Implementation
+//
+// dink_detail_for_each_resolve applies dink_detail_resolve to each requested
+// type, separating declarations with semicolons so the caller supplies the
+// last one. Recursion is deferred and rescanned by dink_detail_expand, which
+// allows up to 342 requested types per use.
+// ----------------------------------------------------------------------------
+
+#define dink_detail_resolve(keyword, Container, Requested) \
+  keyword auto Container::resolve<Requested>()             \
+      -> ::dink::meta::RemoveRvalueRef<Requested>
+
+#define dink_detail_for_each_resolve(keyword, Container, ...)      \
+  __VA_OPT__(dink_detail_expand(                                   \
+      dink_detail_for_each_resolve_step(keyword, Container, __VA_ARGS__)))
+
+#define dink_detail_for_each_resolve_step(keyword, Container, Requested, ...) \
+  dink_detail_resolve(keyword, Container, Requested)                          \
+  __VA_OPT__(; dink_detail_for_each_resolve_again dink_detail_parens          \
+      (keyword, Container, __VA_ARGS__))
+
+#define dink_detail_parens ()
+#define dink_detail_for_each_resolve_again() \
+  dink_detail_for_each_resolve_step
+
+#define dink_detail_expand(...) \
+  dink_detail_expand4(dink_detail_expand4(dink_detail_expand4(             \
+      dink_detail_expand4(__VA_ARGS__))))
+#define dink_detail_expand4(...) \
+  dink_detail_expand3(dink_detail_expand3(dink_detail_expand3(             \
+      dink_detail_expand3(__VA_ARGS__))))
+#define dink_detail_expand3(...) \
+  dink_detail_expand2(dink_detail_expand2(dink_detail_expand2(             \
+      dink_detail_expand2(__VA_ARGS__))))
+#define dink_detail_expand2(...) \
+  dink_detail_expand1(dink_detail_expand1(dink_detail_expand1(             \
+      dink_detail_expand1(__VA_ARGS__))))
+#define dink_detail_expand1(...) __VA_ARGS__
+
+// clang-format on
@@ -281,6 +281,357 @@ TEST_F(IntegrationTestDependencyInjection,
   EXPECT_EQ(kInitialValue + kInitialValue, service.sum);
 }
 
+TEST_F(IntegrationTestDependencyInjection, resolves_multiple_types_at_once) {
+  struct Pinned {
+    int_t value;
+    explicit Pinned(Dep1& dep) : value{dep.value} {}
+    Pinned(const Pinned&) = delete;
+  };
+
+  auto sut = Container{bind<Dep1>().in<scope::Singleton>(), bind<Dep2>(),
+                       bind<Pinned>()};
+
+  auto [dep1, dep2, pinned] =
+      sut.template resolve<Dep1&, std::shared_ptr<Dep2>, Pinned>();
+
+  EXPECT_EQ(&dep1, &sut.template resolve<Dep1&>());
+  EXPECT_EQ(2, dep2->value);
+  EXPECT_EQ(1, pinned.value);
+}
+
+TEST_F(IntegrationTestDependencyInjection, lazy_dependency_defers_creation) {
+  struct Expensive : Singleton {};
+  struct Consumer {
+    Lazy<Expensive&, AnyContainer> expensive;
+    explicit Consumer(Lazy<Expensive&, AnyContainer> expensive)
+        : expensive{std::move(expensive)} {}
+  };
+
+  auto sut = Container{bind<Expensive>().in<scope::Singleton>()};
+
+  auto consumer = sut.template resolve<Consumer>();
+  EXPECT_EQ(0, Counted::num_instances);
+
+  EXPECT_EQ(&sut.template resolve<Expensive&>(), &consumer.expensive.get());
+  EXPECT_EQ(kInitialValue, consumer.expensive->value);
+  EXPECT_EQ(1, Counted::num_instances);
+}
+
+TEST_F(IntegrationTestDependencyInjection, lazy_binds_to_named_container) {
+  struct Expensive : Singleton {};
+  using App = decltype(Container{bind<Expensive>().in<scope::Singleton>()});
+  struct Consumer {
+    Lazy<Expensive&, App> expensive;
+    explicit Consumer(Lazy<Expensive&, App> expensive)
+        : expensive{std::move(expensive)} {}
+  };
+
+  auto sut = App{bind<Expensive>().in<scope::Singleton>()};
+
+  auto consumer = sut.template resolve<Consumer>();
+  EXPECT_EQ(0, Counted::num_instances);
+
+  EXPECT_EQ(&sut.template resolve<Expensive&>(), &consumer.expensive.get());
+  EXPECT_EQ(1, Counted::num_instances);
+}
+
+TEST_F(IntegrationTestDependencyInjection, provider_resolves_on_demand) {
+  struct Shared : Singleton {};
+  using App = decltype(Container{bind<Dependency>(),
+                                 bind<Shared>().in<scope::Singleton>()});
+  struct Consumer {
+    Provider<Dependency, App> dependencies;
+    Provider<Shared&, App> shared;
+  };
+
+  auto sut = App{bind<Dependency>(), bind<Shared>().in<scope::Singleton>()};
+
+  auto consumer = sut.template resolve<Consumer>();
+  EXPECT_EQ(0, Counted::num_instances);
+
+  EXPECT_NE(consumer.dependencies().id, consumer.dependencies().id);
+  EXPECT_EQ(&consumer.shared(), &consumer.shared());
+  EXPECT_EQ(&sut.template resolve<Shared&>(), &consumer.shared());
+}
+
+TEST_F(IntegrationTestDependencyInjection,
+       any_container_provider_resolves_on_demand) {
+  struct Shared : Singleton {};
+  struct Consumer {
+    Provider<Dependency, AnyContainer> dependencies;
+    Provider<Shared&, AnyContainer> shared;
+  };
+
+  auto sut =
+      Container{bind<Dependency>(), bind<Shared>().in<scope::Singleton>()};
+
+  auto consumer = sut.template resolve<Consumer>();
+  EXPECT_EQ(0, Counted::num_instances);
+
+  EXPECT_NE(consumer.dependencies().id, consumer.dependencies().id);
+  EXPECT_EQ(&consumer.shared(), &consumer.shared());
+  EXPECT_EQ(&sut.template resolve<Shared&>(), &consumer.shared());
+}
+
+TEST_F(IntegrationTestDependencyInjection,
+       resolve_with_overrides_dependency_in_subgraph) {
+  struct Leaf : Counted {};
+  struct Middle {
+    Leaf& leaf;
+  };
+  struct Top {
+    Middle middle;
+    Leaf leaf;
+  };
+
+  auto sut = Container{};
+  auto overridden = Leaf{};
+
+  auto top = sut.template resolve_with<Top>(override<Leaf>(overridden));
+
+  EXPECT_EQ(&overridden, &top.middle.leaf);
+  EXPECT_EQ(overridden.id, top.leaf.id);
+  EXPECT_NE(&overridden, &sut.template resolve<Leaf&>());
+}
+
+TEST_F(IntegrationTestDependencyInjection,
+       resolve_with_does_not_affect_cached_instances) {
+  struct Shared {
+    int_t value;
+  };
+  struct Consumer {
+    Shared& shared;
+    const int_t& value;
+  };
+
+  auto value = kModifiedValue;
+  auto sut = Container{bind<Shared>().in<scope::Singleton>()};
+
+  auto consumer = sut.template resolve_with<Consumer>(override<int_t>(value));
+
+  EXPECT_EQ(&value, &consumer.value);
+  EXPECT_EQ(&sut.template resolve<Shared&>(), &consumer.shared);
+  EXPECT_NE(kModifiedValue, consumer.shared.value);
+}
+
+TEST_F(IntegrationTestDependencyInjection,
+       resolve_with_overrides_interface_binding) {
+  struct Real : IService {
+    int_t get_value() const override { return kInitialValue; }
+  };
+  struct Fake : IService {
+    int_t get_value() const override { return kModifiedValue; }
+  };
+  struct Consumer {
+    IService& service;
+  };
+
+  auto sut = Container{bind<IService>().as<Real>()};
+  auto fake = Fake{};
+
+  auto consumer = sut.template resolve_with<Consumer>(override<IService>(fake));
+
+  EXPECT_EQ(kModifiedValue, consumer.service.get_value());
+  EXPECT_EQ(kInitialValue,
+            sut.template resolve<Consumer>().service.get_value());
+}
+
+TEST_F(IntegrationTestDependencyInjection,
+       assisted_factory_combines_runtime_and_resolved_args) {
+  struct Shared : Singleton {};
+  struct Session {
+    int_t user_id;
+    Dependency& dependency;
+    Shared& shared;
+  };
+  struct Consumer {
+    AssistedFactory<std::unique_ptr<Session>(int_t), AnyContainer>
+        create_session;
+  };
+
+  auto sut =
+      Container{bind<Dependency>().in<scope::Singleton>(),
+                bind<Shared>().in<scope::Singleton>()};
+
+  auto consumer = sut.template resolve<Consumer>();
+  EXPECT_EQ(0, Counted::num_instances);
+
+  auto first = consumer.create_session(kInitialValue);
+  auto second = consumer.create_session(kModifiedValue);
+  EXPECT_EQ(kInitialValue, first->user_id);
+  EXPECT_EQ(kModifiedValue, second->user_id);
+  EXPECT_EQ(&sut.template resolve<Dependency&>(), &first->dependency);
+  EXPECT_EQ(&first->shared, &second->shared);
+}
+
+TEST_F(IntegrationTestDependencyInjection,
+       assisted_factory_creates_through_binding) {
+  struct Session {
+    virtual ~Session() = default;
+    virtual auto user_id() const -> int_t = 0;
+  };
+  struct UserSession : Session {
+    UserSession(int_t id, Dependency& dependency)
+        : id{id}, dependency{dependency} {}
+    auto user_id() const -> int_t override { return id; }
+    int_t id;
+    Dependency& dependency;
+  };
+  struct Token {
+    int_t user_id;
+  };
+
+  auto sut = Container{
+      bind<Dependency>().in<scope::Singleton>(),
+      bind<Session>().as<UserSession>().in<scope::Singleton>(),
+      bind<Token>().via([](int_t id, Dependency&) { return Token{-id}; })};
+  using App = decltype(sut);
+
+  const auto create_session =
+      sut.template resolve<AssistedFactory<std::unique_ptr<Session>(int_t),
+                                           App>>();
+  const auto create_token =
+      sut.template resolve<AssistedFactory<Token(int_t), App>>();
+
+  // The binding's scope is bypassed; each call creates a new instance.
+  auto first = create_session(kInitialValue);
+  auto second = create_session(kModifiedValue);
+  EXPECT_EQ(kInitialValue, first->user_id());
+  EXPECT_EQ(kModifiedValue, second->user_id());
+  EXPECT_EQ(&sut.template resolve<Dependency&>(),
+            &dynamic_cast<UserSession&>(*first).dependency);
+  EXPECT_EQ(-kInitialValue, create_token(kInitialValue).user_id);
+}
+
+// ----------------------------------------------------------------------------
+// Declared Injection Tests
+// ----------------------------------------------------------------------------
+
+struct IntegrationTestDeclaredInjection : IntegrationTest {
+  // Declares one of several ctors, none of which is the greediest.
+  struct Overloaded {
+    using dink_inject = Overloaded(Dep1&, Dep2);
+
+    int_t value;
+    Overloaded(Dep1& d1, Dep2 d2) : value{d1.value * 10 + d2.value} {}
+    Overloaded(Dep2 d2, Dep1& d1) : value{d2.value * 10 + d1.value} {}
+    Overloaded(Dep1, Dep2, Dep3) : value{0} {}
+  };
+
+  // Declares a ctor wider than dink_max_deduced_arity.
+  using D = Dependency;
+  struct Wide {
+    using dink_inject = Wide(D, D, D, D, D, D, D, D, D, D, D, D, D, D, D, D, D);
+    static_assert(dink_max_deduced_arity < 17);
+
+    int_t sum;
+    Wide(D d0, D d1, D d2, D d3, D d4, D d5, D d6, D d7, D d8, D d9, D d10,
+         D d11, D d12, D d13, D d14, D d15, D d16)
+        : sum{d0.value + d1.value + d2.value + d3.value + d4.value + d5.value +
+              d6.value + d7.value + d8.value + d9.value + d10.value +
+              d11.value + d12.value + d13.value + d14.value + d15.value +
+              d16.value} {}
+  };
+};
+
+TEST_F(IntegrationTestDeclaredInjection, selects_declared_overload) {
+  auto sut = Container{bind<Dep1>().in<scope::Singleton>(), bind<Dep2>(),
+                       bind<Dep3>(), bind<Overloaded>()};
+
+  auto overloaded = sut.template resolve<Overloaded>();
+  EXPECT_EQ(12, overloaded.value);
+}
+
+TEST_F(IntegrationTestDeclaredInjection, exceeds_max_deduced_arity) {
+  auto sut = Container{bind<Dependency>(), bind<Wide>()};
+
+  auto wide = sut.template resolve<std::unique_ptr<Wide>>();
+  EXPECT_EQ(17 * kInitialValue, wide->sum);
+  EXPECT_EQ(17, Counted::num_instances);
+}
+
+// ----------------------------------------------------------------------------
+// Aggregate Injection Tests
+// ----------------------------------------------------------------------------
+
+struct IntegrationTestAggregateInjection : IntegrationTest {
+  static constexpr auto kDefaultPort = int_t{8080};
+
+  // Injects only the declared fields.
+  struct ServerConfig {
+    Dep1* dep1;
+    int_t port = kDefaultPort;
+    std::shared_ptr<Dep2> dep2;
+    using dink_inject = InjectFields<&ServerConfig::dep1, &ServerConfig::dep2>;
+  };
+
+  // Has more fields than dink_max_deduced_arity.
+  struct WideConfig {
+    Dep1& d00;
+    Dep1& d01;
+    Dep1& d02;
+    Dep1& d03;
+    Dep1& d04;
+    Dep1& d05;
+    Dep1& d06;
+    Dep1& d07;
+    Dep1& d08;
+    Dep1& d09;
+    Dep1& d10;
+    Dep1& d11;
+    Dep1& d12;
+    Dep1& d13;
+    Dep1& d14;
+    Dep1& d15;
+    Dep1& d16;
+    Dep1& d17;
+  };
+};
+
+TEST_F(IntegrationTestAggregateInjection, injects_every_field_by_default) {
+  struct Config {
+    Dep1& dep1;
+    Dep2 dep2;
+    std::unique_ptr<Dep3> dep3;
+  };
+
+  auto sut = Container{bind<Dep1>().in<scope::Singleton>(), bind<Dep2>(),
+                       bind<Dep3>()};
+
+  auto config = sut.template resolve<Config>();
+  EXPECT_EQ(&sut.template resolve<Dep1&>(), &config.dep1);
+  EXPECT_EQ(2, config.dep2.value);
+  EXPECT_EQ(3, config.dep3->value);
+}
+
+TEST_F(IntegrationTestAggregateInjection, injects_wide_aggregate) {
+  auto sut = Container{bind<Dep1>().in<scope::Singleton>()};
+
+  auto config = sut.template resolve<std::unique_ptr<WideConfig>>();
+  EXPECT_EQ(&sut.template resolve<Dep1&>(), &config->d00);
+  EXPECT_EQ(&config->d00, &config->d17);
+}
+
+TEST_F(IntegrationTestAggregateInjection, injects_declared_fields) {
+  auto sut = Container{bind<Dep1>().in<scope::Singleton>(),
+                       bind<Dep2>().in<scope::Singleton>()};
+
+  auto config = sut.template resolve<ServerConfig>();
+  EXPECT_EQ(sut.template resolve<Dep1*>(), config.dep1);
+  EXPECT_EQ(kDefaultPort, config.port);
+  EXPECT_EQ(2, config.dep2->value);
+}
+
+TEST_F(IntegrationTestAggregateInjection, declared_fields_in_singleton) {
+  auto sut = Container{bind<Dep1>(), bind<Dep2>(),
+                       bind<ServerConfig>().in<scope::Singleton>()};
+
+  auto& config = sut.template resolve<ServerConfig&>();
+  EXPECT_EQ(&config, &sut.template resolve<ServerConfig&>());
+  EXPECT_EQ(1, config.dep1->value);
+  EXPECT_EQ(kDefaultPort, config.port);
+}
+
 // =============================================================================
 // POLYMORPHISM - Interfaces and Implementations
 // Binding interfaces to concrete implementations
@@ -441,6 +792,145 @@ TEST_F(IntegrationTestMultipleInheritance,
   EXPECT_EQ(2, service2.get_value2());
 }
 
+// ----------------------------------------------------------------------------
+// Multibinding Tests
+// ----------------------------------------------------------------------------
+
+struct IntegrationTestMultibinding : IntegrationTest {
+  struct Service1 : IService {
+    int_t get_value() const override { return 1; }
+  };
+  struct Service2 : IService {
+    int_t get_value() const override { return 2; }
+  };
+  struct Service3 : IService {
+    int_t get_value() const override { return 3; }
+  };
+};
+
+TEST_F(IntegrationTestMultibinding, resolves_set_as_span_in_binding_order) {
+  auto service3 = Service3{};
+  auto sut = Container{
+      bind<SetOf<IService>>().as<Service1>(),
+      bind<IService>().as<Service2>(),
+      bind<SetOf<IService>>().as<Service2>().in<scope::Singleton>(),
+      bind<SetOf<IService>>().to(service3)};
+
+  auto services = sut.template resolve<std::span<IService* const>>();
+
+  ASSERT_EQ(3, services.size());
+  EXPECT_EQ(1, services[0]->get_value());
+  EXPECT_EQ(2, services[1]->get_value());
+  EXPECT_EQ(&service3, services[2]);
+}
+
+TEST_F(IntegrationTestMultibinding, span_views_cached_contiguous_array) {
+  struct Consumer {
+    std::span<IService* const, 2> services;
+  };
+
+  auto sut = Container{bind<SetOf<IService>>().as<Service1>(),
+                       bind<SetOf<IService>>().as<Service2>()};
+
+  auto services = sut.template resolve<std::span<IService* const>>();
+  auto consumer = sut.template resolve<Consumer>();
+
+  EXPECT_EQ(services.data(), consumer.services.data());
+  EXPECT_EQ(&sut.template resolve<Service1&>(), services[0]);
+}
+
+TEST_F(IntegrationTestMultibinding, resolves_set_as_tuple_of_concrete_types) {
+  auto sut = Container{bind<SetOf<IService>>().as<Service1>(),
+                       bind<SetOf<IService>>().as<Service3>()};
+
+  auto services = sut.template resolve_set<IService>();
+  static_assert(
+      std::same_as<std::tuple<Service1&, Service3&>, decltype(services)>);
+
+  auto sum = std::apply(
+      [](auto&... services) { return (services.get_value() + ...); },
+      services);
+  EXPECT_EQ(4, sum);
+  EXPECT_EQ(&sut.template resolve<Service3&>(), &std::get<1>(services));
+}
+
+TEST_F(IntegrationTestMultibinding, unbound_set_is_empty) {
+  auto sut = Container{bind<IService>().as<Service1>()};
+
+  EXPECT_TRUE(sut.template resolve<std::span<IService* const>>().empty());
+  using Set = decltype(sut.template resolve_set<IService>());
+  EXPECT_EQ(0, std::tuple_size_v<Set>);
+}
+
+// ----------------------------------------------------------------------------
+// Qualified Binding Tests
+// ----------------------------------------------------------------------------
+
+struct IntegrationTestQualified : IntegrationTest {
+  struct Primary {};
+  struct Replica {};
+
+  struct Pool {
+    Pool() = default;
+    int_t port = kInitialValue;
+  };
+
+  struct Service : IService {
+    int_t get_value() const override { return kInitialValue; }
+  };
+};
+
+TEST_F(IntegrationTestQualified, qualifiers_select_distinct_singletons) {
+  auto sut = Container{
+      bind<Pool>().named<Primary>().in<scope::Singleton>(),
+      bind<Pool>().named<Replica>().in<scope::Singleton>(),
+  };
+
+  auto primary = sut.template resolve<Named<Primary, Pool&>>();
+  auto replica = sut.template resolve<Named<Replica, Pool&>>();
+
+  auto primary_again = sut.template resolve<Named<Primary, Pool&>>();
+
+  EXPECT_NE(&primary.get(), &replica.get());
+  EXPECT_EQ(&primary.get(), &primary_again.get());
+  EXPECT_NE(&primary.get(), &sut.template resolve<Pool&>());
+}
+
+TEST_F(IntegrationTestQualified, qualified_factories_configure_instances) {
+  struct Consumer {
+    Named<Primary, Pool&> primary;
+    Named<Replica, Pool*> replica;
+  };
+
+  auto sut = Container{
+      bind<Pool>().named<Primary>().in<scope::Singleton>(),
+      bind<Pool>()
+          .named<Replica>()
+          .via([] {
+            auto pool = Pool{};
+            pool.port = kModifiedValue;
+            return pool;
+          })
+          .in<scope::Singleton>(),
+  };
+
+  auto consumer = sut.template resolve<Consumer>();
+
+  EXPECT_EQ(kInitialValue, consumer.primary->port);
+  EXPECT_EQ(kModifiedValue, consumer.replica->port);
+}
+
+TEST_F(IntegrationTestQualified, transient_qualified_binding_creates_values) {
+  auto sut = Container{bind<IService>().named<Primary>().as<Service>()};
+
+  using Requested = Named<Primary, std::unique_ptr<IService>>;
+  auto first = sut.template resolve<Requested>();
+  auto second = sut.template resolve<Requested>();
+
+  EXPECT_NE(first.get().get(), second.get().get());
+  EXPECT_EQ(kInitialValue, first->get_value());
+}
+
 // =============================================================================
 // MIXED SCOPES
 // Multiple scope types coexisting in one container
@@ -571,5 +1061,26 @@ TEST_F(IntegrationTestEdgeCases, type_with_deleted_copy_constructor) {
   EXPECT_EQ(kInitialValue, ptr->value);
 }
 
+TEST_F(IntegrationTestEdgeCases, non_movable_type_resolved_into_storage) {
+  struct Pinned {
+    int_t value;
+    explicit Pinned(Dependency dep) : value{dep.value} {}
+    Pinned(const Pinned&) = delete;
+  };
+
+  auto sut = Container{bind<Dependency>(), bind<Pinned>()};
+
+  const auto pinned = resolve_unique<Pinned>(sut, std::allocator<Pinned>{});
+  EXPECT_EQ(kInitialValue, pinned->value);
+}
+
+TEST_F(IntegrationTestEdgeCases, movable_type_resolved_into_optional) {
+  auto sut = Container{bind<Dependency>()};
+
+  auto optional = std::optional<Dependency>{};
+  resolve_into(sut, optional);
+  EXPECT_EQ(kInitialValue, optional->value);
+}
+
 }  // namespace
 }  // namespace dink::container
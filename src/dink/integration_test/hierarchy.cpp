@@ -100,6 +100,35 @@ TEST_F(IntegrationTestHierarchyDelegation,
   EXPECT_EQ(kInitialValue, result.value);
 }
 
+TEST_F(IntegrationTestHierarchyDelegation,
+       handle_binds_to_requesting_child) {
+  auto parent = Container{bind<Type>()};
+  auto child = Container{parent};
+  using Child = decltype(child);
+
+  // Type is only bound in the parent, but the handle must bind to the child.
+  auto provider = child.template resolve<Provider<Type, Child>>();
+
+  EXPECT_EQ(kInitialValue, provider().value);
+}
+
+TEST_F(IntegrationTestHierarchyDelegation,
+       set_resolves_from_nearest_contributing_container) {
+  struct Element : Type {};
+  auto parent = Container{bind<SetOf<Type>>().as<Type>(),
+                          bind<SetOf<Type>>().as<Element>()};
+  auto child = Container{parent};
+  auto grandchild = Container{child, bind<SetOf<Type>>().as<Element>()};
+
+  // Child has no contributions, so it sees the parent's set.
+  EXPECT_EQ(&std::get<1>(parent.template resolve_set<Type>()),
+            &std::get<1>(child.template resolve_set<Type>()));
+  EXPECT_EQ(2, child.template resolve<std::span<Type* const>>().size());
+
+  // Grandchild contributions replace the set rather than extending it.
+  EXPECT_EQ(1, grandchild.template resolve<std::span<Type* const>>().size());
+}
+
 // ----------------------------------------------------------------------------
 // Hierarchical Container Tests - Singleton Sharing
 // ----------------------------------------------------------------------------
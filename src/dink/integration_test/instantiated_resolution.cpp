@@ -0,0 +1,48 @@
+/*
+  Copyright (c) 2025 Frank Secilia \n
+  SPDX-License-Identifier: MIT
+*/
+
+#include "instantiation.hpp"
+
+namespace dink::instantiation {
+namespace {
+
+// =============================================================================
+// INSTANTIATED RESOLUTION - Paths Instantiated in Another Translation Unit
+// Resolution paths declared extern here are defined in instantiation.cpp
+// =============================================================================
+
+struct IntegrationTestInstantiatedResolution : IntegrationTest {
+  SharedContainer sut{bind<Logger>().in<scope::Singleton>()};
+};
+
+TEST_F(IntegrationTestInstantiatedResolution, resolves_declared_reference) {
+  auto& logger = sut.template resolve<Logger&>();
+
+  EXPECT_EQ(kInitialValue, logger.value);
+  EXPECT_EQ(&logger, &sut.template resolve<Logger&>());
+}
+
+TEST_F(IntegrationTestInstantiatedResolution, resolves_declared_value) {
+  auto service = sut.template resolve<Service>();
+
+  EXPECT_EQ(&sut.template resolve<Logger&>(), &service.logger);
+}
+
+TEST_F(IntegrationTestInstantiatedResolution,
+       resolves_declared_value_with_undeclared_dependencies) {
+  auto client = sut.template resolve<Client>();
+
+  EXPECT_EQ(&sut.template resolve<Logger&>(), &client.service.logger);
+  EXPECT_EQ(&sut.template resolve<Logger&>(), client.logger.get());
+}
+
+TEST_F(IntegrationTestInstantiatedResolution, resolves_undeclared_paths) {
+  auto logger = sut.template resolve<std::shared_ptr<Logger>>();
+
+  EXPECT_EQ(&sut.template resolve<Logger&>(), logger.get());
+}
+
+}  // namespace
+}  // namespace dink::instantiation
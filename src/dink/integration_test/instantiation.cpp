@@ -0,0 +1,11 @@
+/*
+  Copyright (c) 2025 Frank Secilia \n
+  SPDX-License-Identifier: MIT
+*/
+
+#include "instantiation.hpp"
+
+dink_instantiate_resolve(dink::instantiation::SharedContainer,
+                         dink::instantiation::Logger&,
+                         dink::instantiation::Service,
+                         dink::instantiation::Client);
@@ -0,0 +1,40 @@
+/*!
+  \file
+  \brief Container type whose resolution paths are instantiated once.
+
+  \copyright Copyright (c) 2025 Frank Secilia \n
+  SPDX-License-Identifier: MIT
+*/
+
+#pragma once
+
+#include "integration_test.hpp"
+#include <dink/instantiate.hpp>
+
+namespace dink::instantiation {
+
+struct Logger {
+  int_t value = IntegrationTest::kInitialValue;
+  Logger() = default;
+};
+
+struct Service {
+  Logger& logger;
+  explicit Service(Logger& logger) : logger{logger} {}
+};
+
+struct Client {
+  Service service;
+  std::shared_ptr<Logger> logger;
+  Client(Service service, std::shared_ptr<Logger> logger)
+      : service{std::move(service)}, logger{std::move(logger)} {}
+};
+
+using SharedContainer =
+    decltype(Container{bind<Logger>().in<scope::Singleton>()});
+
+}  // namespace dink::instantiation
+
+dink_extern_resolve(dink::instantiation::SharedContainer,
+                    dink::instantiation::Logger&,
+                    dink::instantiation::Service, dink::instantiation::Client);
@@ -9,11 +9,18 @@
 #pragma once
 
 #include <dink/test.hpp>
+#include <dink/assisted_factory.hpp>
 #include <dink/binding.hpp>
 #include <dink/binding_dsl.hpp>
 #include <dink/cache.hpp>
 #include <dink/container.hpp>
+#include <dink/emplace.hpp>
+#include <dink/lazy.hpp>
+#include <dink/multibinding.hpp>
+#include <dink/named.hpp>
+#include <dink/override.hpp>
 #include <dink/provider.hpp>
+#include <dink/provider_handle.hpp>
 #include <dink/scope.hpp>
 
 namespace dink {
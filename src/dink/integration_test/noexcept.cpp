@@ -0,0 +1,193 @@
+/*
+  Copyright (c) 2025 Frank Secilia \n
+  SPDX-License-Identifier: MIT
+*/
+
+#include "integration_test.hpp"
+#include <dink/inline_poly.hpp>
+#include <dink/plan.hpp>
+#include <cstddef>
+#include <memory>
+#include <utility>
+
+namespace dink::container {
+namespace {
+
+// =============================================================================
+// NOEXCEPT - Exception Specification of Resolution
+// Resolution is noexcept when nothing in the graph behind the request can throw
+// =============================================================================
+
+struct IntegrationTestNoexcept : IntegrationTest {
+  struct Leaf {
+    using dink_inject = Leaf();
+    Leaf() noexcept = default;
+    int_t value = kInitialValue;
+  };
+
+  struct Throwing {
+    using dink_inject = Throwing();
+    Throwing() noexcept(false) {}
+  };
+
+  struct Top {
+    using dink_inject = Top(Leaf, const Leaf&, Leaf*);
+    Top(Leaf leaf, const Leaf& ref, Leaf* ptr) noexcept
+        : leaf{leaf}, ref{ref}, ptr{ptr} {}
+    Leaf leaf;
+    const Leaf& ref;
+    Leaf* ptr;
+  };
+
+  // Nothrow itself, but a dependency throws.
+  struct UsesThrowing {
+    using dink_inject = UsesThrowing(Leaf, Throwing);
+    UsesThrowing(Leaf, Throwing) noexcept {}
+  };
+
+  struct Fields {
+    Leaf leaf;
+    Leaf* ptr = nullptr;
+    using dink_inject = InjectFields<&Fields::leaf, &Fields::ptr>;
+  };
+
+  struct UsesLazy {
+    using dink_inject = UsesLazy(Lazy<Leaf&, AnyContainer>);
+    explicit UsesLazy(Lazy<Leaf&, AnyContainer> leaf) noexcept
+        : leaf{std::move(leaf)} {}
+    Lazy<Leaf&, AnyContainer> leaf;
+  };
+
+  struct Interface {
+    virtual ~Interface() = default;
+    virtual auto value() const noexcept -> int_t = 0;
+  };
+
+  struct Small : Interface {
+    using dink_inject = Small(Leaf);
+    explicit Small(Leaf leaf) noexcept : leaf{leaf} {}
+    auto value() const noexcept -> int_t override { return leaf.value; }
+    Leaf leaf;
+  };
+
+  static constexpr auto kCapacity = std::size_t{32};
+  using Poly = InlinePoly<Interface, kCapacity>;
+
+  struct Large : Small {
+    using dink_inject = Large(Leaf);
+    using Small::Small;
+    std::byte padding[2 * kCapacity] = {};
+  };
+
+  template <typename Requested, typename Container>
+  static constexpr auto is_nothrow_resolve =
+      noexcept(std::declval<Container&>().template resolve<Requested>());
+};
+
+// Values, references, and pointers
+// ----------------------------------------------------------------------------
+
+TEST_F(IntegrationTestNoexcept, nothrow_graph_is_noexcept) {
+  auto sut = dink_unique_container();
+
+  static_assert(is_nothrow_resolve<Leaf, decltype(sut)>);
+  static_assert(is_nothrow_resolve<Leaf&&, decltype(sut)>);
+  static_assert(is_nothrow_resolve<Leaf&, decltype(sut)>);
+  static_assert(is_nothrow_resolve<const Leaf*, decltype(sut)>);
+  static_assert(is_nothrow_resolve<Top, decltype(sut)>);
+  static_assert(is_nothrow_resolve<Fields, decltype(sut)>);
+
+  const auto result = sut.template resolve<Top>();
+  EXPECT_EQ(kInitialValue, result.leaf.value);
+  EXPECT_EQ(&result.ref, result.ptr);
+}
+
+TEST_F(IntegrationTestNoexcept, throwing_ctor_is_not_noexcept) {
+  auto sut = dink_unique_container();
+
+  static_assert(!is_nothrow_resolve<Throwing, decltype(sut)>);
+  static_assert(!is_nothrow_resolve<UsesThrowing, decltype(sut)>);
+}
+
+// Allocation
+// ----------------------------------------------------------------------------
+
+TEST_F(IntegrationTestNoexcept, owning_pointers_are_not_noexcept) {
+  auto sut = dink_unique_container();
+
+  static_assert(!is_nothrow_resolve<std::unique_ptr<Leaf>, decltype(sut)>);
+  static_assert(!is_nothrow_resolve<std::shared_ptr<Leaf>, decltype(sut)>);
+}
+
+TEST_F(IntegrationTestNoexcept, inline_poly_is_noexcept_only_inline) {
+  auto inline_impl = dink_unique_container(bind<Interface>().as<Small>());
+  auto heap_impl = dink_unique_container(bind<Interface>().as<Large>());
+
+  static_assert(is_nothrow_resolve<Poly, decltype(inline_impl)>);
+  static_assert(!is_nothrow_resolve<Poly, decltype(heap_impl)>);
+}
+
+// Bindings
+// ----------------------------------------------------------------------------
+
+TEST_F(IntegrationTestNoexcept, singleton_reference_is_noexcept) {
+  auto sut = dink_unique_container(bind<Throwing>().in<scope::Singleton>());
+
+  // The instance is created at most once, but that may still throw.
+  static_assert(!is_nothrow_resolve<Throwing&, decltype(sut)>);
+  static_assert(is_nothrow_resolve<Leaf&, decltype(sut)>);
+}
+
+TEST_F(IntegrationTestNoexcept, instance_reference_is_noexcept) {
+  auto leaf = Leaf{};
+  auto sut = dink_unique_container(bind<Leaf>().to(leaf));
+
+  static_assert(is_nothrow_resolve<Leaf&, decltype(sut)>);
+  static_assert(is_nothrow_resolve<Leaf, decltype(sut)>);
+
+  EXPECT_EQ(&leaf, &sut.template resolve<Leaf&>());
+}
+
+TEST_F(IntegrationTestNoexcept, factory_follows_its_exception_spec) {
+  auto nothrow = dink_unique_container(
+      bind<Top>().via([](Leaf leaf, Leaf& ref) noexcept {
+        return Top{leaf, ref, &ref};
+      }));
+  auto throwing = dink_unique_container(
+      bind<Top>().via([](Leaf leaf, Leaf& ref) {
+        return Top{leaf, ref, &ref};
+      }));
+
+  static_assert(is_nothrow_resolve<Top, decltype(nothrow)>);
+  static_assert(!is_nothrow_resolve<Top, decltype(throwing)>);
+}
+
+TEST_F(IntegrationTestNoexcept, lazy_handle_is_noexcept) {
+  auto sut = dink_unique_container();
+
+  static_assert(is_nothrow_resolve<UsesLazy, decltype(sut)>);
+}
+
+// Hierarchies and plans
+// ----------------------------------------------------------------------------
+
+TEST_F(IntegrationTestNoexcept, parent_binding_is_noexcept) {
+  auto parent = dink_unique_container(bind<Leaf>().in<scope::Singleton>());
+  auto sut = dink_unique_container(parent);
+
+  static_assert(is_nothrow_resolve<Leaf&, decltype(sut)>);
+  static_assert(is_nothrow_resolve<Top, decltype(sut)>);
+
+  EXPECT_EQ(&parent.template resolve<Leaf&>(),
+            &sut.template resolve<Leaf&>());
+}
+
+TEST_F(IntegrationTestNoexcept, planned_resolution_follows_graph) {
+  auto sut = dink_unique_container();
+
+  static_assert(noexcept(resolve_planned<Top>(sut)));
+  static_assert(!noexcept(resolve_planned<UsesThrowing>(sut)));
+}
+
+}  // namespace
+}  // namespace dink::container
@@ -564,6 +564,150 @@ TEST_F(IntegrationTestSingleton, multiple_singleton_types) {
   EXPECT_NE(shared2.get(), nullptr);
 }
 
+// ----------------------------------------------------------------------------
+// PerGraph Scope Tests
+// ----------------------------------------------------------------------------
+
+struct IntegrationTestPerGraph : IntegrationTest {
+  struct Shared : Initialized {};
+
+  // Requests Shared twice through different paths, as a diamond.
+  struct Left {
+    std::shared_ptr<Shared> shared;
+    explicit Left(std::shared_ptr<Shared> shared) : shared{std::move(shared)} {}
+  };
+  struct Right {
+    std::shared_ptr<Shared> shared;
+    explicit Right(std::shared_ptr<Shared> shared)
+        : shared{std::move(shared)} {}
+  };
+  struct Root {
+    Left left;
+    Right right;
+    Root(Left left, Right right)
+        : left{std::move(left)}, right{std::move(right)} {}
+  };
+
+  // Requests Shared twice by value.
+  struct Values {
+    Shared first;
+    Shared second;
+    Values(Shared first, Shared second) : first{first}, second{second} {}
+  };
+
+  // Requests Shared twice by reference, as a diamond. The references dangle
+  // once the graph ends, so each keeps only what it saw.
+  struct RefLeft {
+    const Shared* address;
+    int_t id;
+    explicit RefLeft(Shared& shared) : address{&shared}, id{shared.id} {}
+  };
+  struct RefRight {
+    const Shared* address;
+    int_t id;
+    explicit RefRight(Shared& shared) : address{&shared}, id{shared.id} {}
+  };
+  struct RefRoot {
+    RefLeft left;
+    RefRight right;
+    RefRoot(RefLeft left, RefRight right) : left{left}, right{right} {}
+  };
+};
+
+// Uniqueness (Per Graph)
+// ----------------------------------------------------------------------------
+
+TEST_F(IntegrationTestPerGraph, copies_shared_ptr_within_graph) {
+  auto sut = Container{bind<Shared>().in<scope::PerGraph>()};
+
+  const auto root = sut.template resolve<Root>();
+
+  EXPECT_NE(root.left.shared, root.right.shared);
+  EXPECT_EQ(root.left.shared->id, root.right.shared->id);
+  EXPECT_EQ(1, Counted::num_instances);
+}
+
+TEST_F(IntegrationTestPerGraph, creates_new_shared_ptr_per_graph) {
+  auto sut = Container{bind<Shared>().in<scope::PerGraph>()};
+
+  const auto root1 = sut.template resolve<Root>();
+  const auto root2 = sut.template resolve<Root>();
+
+  EXPECT_NE(root1.left.shared->id, root2.left.shared->id);
+  EXPECT_EQ(2, Counted::num_instances);
+}
+
+TEST_F(IntegrationTestPerGraph, shares_reference_within_graph) {
+  auto sut = Container{bind<Shared>().in<scope::PerGraph>()};
+
+  const auto root = sut.template resolve<RefRoot>();
+
+  EXPECT_EQ(root.left.address, root.right.address);
+  EXPECT_EQ(1, Counted::num_instances);
+}
+
+TEST_F(IntegrationTestPerGraph, creates_new_reference_per_graph) {
+  auto sut = Container{bind<Shared>().in<scope::PerGraph>()};
+
+  const auto root1 = sut.template resolve<RefRoot>();
+  const auto root2 = sut.template resolve<RefRoot>();
+
+  EXPECT_NE(root1.left.id, root2.left.id);
+  EXPECT_EQ(2, Counted::num_instances);
+}
+
+TEST_F(IntegrationTestPerGraph, copies_value_within_graph) {
+  auto sut = Container{bind<Shared>().in<scope::PerGraph>()};
+
+  const auto values = sut.template resolve<Values>();
+
+  EXPECT_EQ(values.first.id, values.second.id);
+  EXPECT_EQ(1, Counted::num_instances);
+}
+
+TEST_F(IntegrationTestPerGraph, creates_new_value_per_graph) {
+  auto sut = Container{bind<Shared>().in<scope::PerGraph>()};
+
+  const auto values1 = sut.template resolve<Values>();
+  const auto values2 = sut.template resolve<Values>();
+
+  EXPECT_NE(values1.first.id, values2.first.id);
+}
+
+TEST_F(IntegrationTestPerGraph, shared_ptr_outlives_graph) {
+  auto sut = Container{bind<Shared>().in<scope::PerGraph>()};
+
+  const auto shared = sut.template resolve<std::shared_ptr<Shared>>();
+
+  EXPECT_EQ(kInitialValue, shared->value);
+}
+
+TEST_F(IntegrationTestPerGraph, shares_within_graph_resolved_from_child) {
+  auto parent = Container{bind<Shared>().in<scope::PerGraph>()};
+  auto sut = Container{parent};
+
+  const auto root = sut.template resolve<RefRoot>();
+
+  EXPECT_EQ(root.left.address, root.right.address);
+}
+
+TEST_F(IntegrationTestPerGraph, shares_within_graph_resolved_with_overrides) {
+  auto sut = Container{bind<Shared>().in<scope::PerGraph>()};
+  auto dependency = Dependency{};
+
+  const auto root = sut.template resolve_with<RefRoot>(
+      override<Dependency>(dependency));
+
+  EXPECT_EQ(root.left.address, root.right.address);
+}
+
+TEST_F(IntegrationTestPerGraph, opens_graphs_only_for_containers_binding_it) {
+  static_assert(container::detail::opens_graphs<
+                decltype(Container{bind<Shared>().in<scope::PerGraph>()})>);
+  static_assert(!container::detail::opens_graphs<
+                decltype(Container{bind<Shared>().in<scope::Transient>()})>);
+}
+
 // ----------------------------------------------------------------------------
 // Instance Scope Tests (External References)
 // ----------------------------------------------------------------------------
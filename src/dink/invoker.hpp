@@ -7,13 +7,54 @@
 #pragma once
 
 #include <dink/lib.hpp>
+#include <dink/aggregate.hpp>
 #include <dink/arity.hpp>
+#include <dink/cycle.hpp>
+#include <dink/inject.hpp>
 #include <dink/meta.hpp>
 #include <dink/resolver.hpp>
+#include <concepts>
 #include <memory>
+#include <new>
+#include <tuple>
+#include <type_traits>
 #include <utility>
 
 namespace dink {
+namespace invoker {
+
+//! Lets container check Invoker's parameters before it resolves them.
+//
+// Adapters that supply some parameters themselves define a static
+// check_invoker<Invoker>() to reject invocations at compile time, e.g.
+// AssistedFactory's, which forwards each runtime argument once.
+template <typename Invoker, typename Container>
+constexpr auto check(Container& /*container*/) noexcept -> void {
+  if constexpr (requires { Container::template check_invoker<Invoker>(); }) {
+    Container::template check_invoker<Invoker>();
+  }
+}
+
+//! Creates a TreeUniquePtr node, in container's block if it has room.
+//
+// Only TreeContainer has a block. place(address) constructs the node in it.
+// Otherwise, create_unique() allocates the node individually. Node and the
+// block are only named through their types, so invokers don't include
+// unique_tree.hpp. \sa unique_tree.hpp
+template <typename Node, typename Constructed, typename Container,
+          typename Place, typename CreateUnique>
+constexpr auto create_tree_node(Container& container, Place place,
+                                CreateUnique create_unique) -> Node {
+  if constexpr (requires { container.template allocate_node<Constructed>(); }) {
+    const auto node = container.template allocate_node<Constructed>();
+    if (node.address) {
+      return node.own(place(node.address));
+    }
+  }
+  return Node{create_unique()};
+}
+
+}  // namespace invoker
 
 //! Invokes a ctor or factory by replacing an index sequence.
 //
@@ -31,7 +72,11 @@ class Invoker<Constructed, void, ResolverSequence,
               std::index_sequence<indices...>> {
  public:
   template <typename Container>
-  constexpr auto create_value(Container& container) const -> Constructed {
+  constexpr auto create_value(Container& container) const
+      noexcept(noexcept(Constructed{
+          resolver_sequence_.template create_element<
+              Constructed, sizeof...(indices), indices>(container)...}))
+          -> Constructed {
     return Constructed{
         resolver_sequence_
             .template create_element<Constructed, sizeof...(indices), indices>(
@@ -56,14 +101,47 @@ class Invoker<Constructed, void, ResolverSequence,
                 container)...);
   }
 
+  template <typename Node, typename Container>
+  constexpr auto create_tree_node(Container& container) const -> Node {
+    return invoker::create_tree_node<Node, Constructed>(
+        container,
+        [&](void* address) {
+          return ::new (address) Constructed(
+              resolver_sequence_.template create_element<
+                  Constructed, sizeof...(indices), indices>(container)...);
+        },
+        [&] { return create_unique(container); });
+  }
+
+  template <typename Poly, typename Container>
+  constexpr auto create_inline_poly(Container& container) const
+      noexcept(noexcept(Poly{
+          std::in_place_type<Constructed>,
+          resolver_sequence_.template create_element<
+              Constructed, sizeof...(indices), indices>(container)...}))
+          -> Poly {
+    return Poly{
+        std::in_place_type<Constructed>,
+        resolver_sequence_
+            .template create_element<Constructed, sizeof...(indices), indices>(
+                container)...};
+  }
+
   template <typename Requested, typename Container>
-  constexpr auto create(Container& container) const -> auto {
-    if constexpr (meta::IsSharedPtr<Requested>) {
-      return create_shared(container);
+  constexpr auto create(Container& container) const
+      noexcept(is_nothrow_create<Requested, Container>()) -> auto {
+    invoker::check<Invoker>(container);
+    auto&& constructing = cycle::enter<Constructed>(container);
+    if constexpr (meta::IsTreeUniquePtr<Requested>) {
+      return create_tree_node<std::remove_cvref_t<Requested>>(constructing);
+    } else if constexpr (meta::IsSharedPtr<Requested>) {
+      return create_shared(constructing);
     } else if constexpr (meta::IsUniquePtr<Requested>) {
-      return create_unique(container);
+      return create_unique(constructing);
+    } else if constexpr (meta::IsInlinePoly<Requested>) {
+      return create_inline_poly<std::remove_cvref_t<Requested>>(constructing);
     } else {
-      return create_value(container);
+      return create_value(constructing);
     }
   }
 
@@ -74,6 +152,28 @@ class Invoker<Constructed, void, ResolverSequence,
 
  private:
   ResolverSequence resolver_sequence_{};
+
+  //! true if create() cannot throw; pointers allocate, so they always can.
+  template <typename Requested, typename Container>
+  static constexpr auto is_nothrow_create() noexcept -> bool {
+    using Entered = cycle::Entered<Constructed, Container>;
+    if constexpr (meta::IsTreeUniquePtr<Requested> ||
+                  meta::IsSharedPtr<Requested> ||
+                  meta::IsUniquePtr<Requested>) {
+      return false;
+    } else if constexpr (meta::IsInlinePoly<Requested>) {
+      return noexcept(std::remove_cvref_t<Requested>{
+          std::in_place_type<Constructed>,
+          std::declval<const ResolverSequence&>()
+              .template create_element<Constructed, sizeof...(indices),
+                                       indices>(std::declval<Entered&>())...});
+    } else {
+      return noexcept(Constructed{
+          std::declval<const ResolverSequence&>()
+              .template create_element<Constructed, sizeof...(indices),
+                                       indices>(std::declval<Entered&>())...});
+    }
+  }
 };
 
 //! Factory specialization.
@@ -85,7 +185,10 @@ class Invoker<Constructed, ConstructedFactory, ResolverSequence,
   template <typename Container>
   constexpr auto create_value(Container& container,
                               ConstructedFactory& constructed_factory) const
-      -> Constructed {
+      noexcept(noexcept(Constructed(constructed_factory(
+          resolver_sequence_.template create_element<
+              Constructed, sizeof...(indices), indices>(container)...))))
+          -> Constructed {
     return constructed_factory(
         resolver_sequence_
             .template create_element<Constructed, sizeof...(indices), indices>(
@@ -112,16 +215,53 @@ class Invoker<Constructed, ConstructedFactory, ResolverSequence,
                 container)...));
   }
 
+  template <typename Node, typename Container>
+  constexpr auto create_tree_node(Container& container,
+                                  ConstructedFactory& constructed_factory) const
+      -> Node {
+    return invoker::create_tree_node<Node, Constructed>(
+        container,
+        [&](void* address) {
+          return ::new (address) Constructed(constructed_factory(
+              resolver_sequence_.template create_element<
+                  Constructed, sizeof...(indices), indices>(container)...));
+        },
+        [&] { return create_unique(container, constructed_factory); });
+  }
+
+  template <typename Poly, typename Container>
+  constexpr auto create_inline_poly(
+      Container& container, ConstructedFactory& constructed_factory) const
+      noexcept(noexcept(Poly{
+          std::in_place_type<Constructed>,
+          constructed_factory(resolver_sequence_.template create_element<
+                              Constructed, sizeof...(indices), indices>(
+              container)...)})) -> Poly {
+    return Poly{
+        std::in_place_type<Constructed>,
+        constructed_factory(
+            resolver_sequence_.template create_element<
+                Constructed, sizeof...(indices), indices>(container)...)};
+  }
+
   template <typename Requested, typename Container>
   constexpr auto create(Container& container,
                         ConstructedFactory& constructed_factory) const
-      -> Requested {
-    if constexpr (meta::IsSharedPtr<Requested>) {
-      return create_shared(container, constructed_factory);
+      noexcept(is_nothrow_create<Requested, Container>()) -> Requested {
+    invoker::check<Invoker>(container);
+    auto&& constructing = cycle::enter<Constructed>(container);
+    if constexpr (meta::IsTreeUniquePtr<Requested>) {
+      return create_tree_node<std::remove_cvref_t<Requested>>(
+          constructing, constructed_factory);
+    } else if constexpr (meta::IsSharedPtr<Requested>) {
+      return create_shared(constructing, constructed_factory);
     } else if constexpr (meta::IsUniquePtr<Requested>) {
-      return create_unique(container, constructed_factory);
+      return create_unique(constructing, constructed_factory);
+    } else if constexpr (meta::IsInlinePoly<Requested>) {
+      return create_inline_poly<std::remove_cvref_t<Requested>>(
+          constructing, constructed_factory);
     } else {
-      return create_value(container, constructed_factory);
+      return create_value(constructing, constructed_factory);
     }
   }
 
@@ -132,6 +272,265 @@ class Invoker<Constructed, ConstructedFactory, ResolverSequence,
 
  private:
   ResolverSequence resolver_sequence_{};
+
+  //! true if create() cannot throw; pointers allocate, so they always can.
+  template <typename Requested, typename Container>
+  static constexpr auto is_nothrow_create() noexcept -> bool {
+    using Entered = cycle::Entered<Constructed, Container>;
+    if constexpr (meta::IsTreeUniquePtr<Requested> ||
+                  meta::IsSharedPtr<Requested> ||
+                  meta::IsUniquePtr<Requested>) {
+      return false;
+    } else if constexpr (meta::IsInlinePoly<Requested>) {
+      return noexcept(std::remove_cvref_t<Requested>{
+          std::in_place_type<Constructed>,
+          std::declval<ConstructedFactory&>()(
+              std::declval<const ResolverSequence&>()
+                  .template create_element<Constructed, sizeof...(indices),
+                                           indices>(
+                      std::declval<Entered&>())...)});
+    } else {
+      return noexcept(Constructed(std::declval<ConstructedFactory&>()(
+          std::declval<const ResolverSequence&>()
+              .template create_element<Constructed, sizeof...(indices),
+                                       indices>(std::declval<Entered&>())...)));
+    }
+  }
+};
+
+//! Injects declared fields of an aggregate.
+//
+// FieldInvoker aggregate-initializes Constructed, initializing each field once.
+// Each field named by Fields is initialized from an instance resolved as the
+// field's type, so named fields may be const. Fields after the last named field
+// keep their default member initializers. Aggregate initialization can't skip a
+// field, so any unnamed fields before it are moved from a value-initialized
+// prototype instead, which is only created if there are such fields.
+template <typename Constructed, typename Fields>
+class FieldInvoker;
+
+template <typename Constructed, auto... fields>
+class FieldInvoker<Constructed, InjectFields<fields...>> {
+ public:
+  static_assert(std::is_aggregate_v<Constructed>,
+                "InjectFields requires an aggregate.");
+  static_assert((std::same_as<meta::MemberClass<fields>, Constructed> && ...),
+                "InjectFields must name fields declared by the aggregate "
+                "itself, not by a base or another type.");
+
+  template <typename Container>
+  constexpr auto create_value(Container& container) const
+      noexcept(is_nothrow_value<Container>()) -> Constructed {
+    return initialize(container, [](auto&&... initializers) {
+      return Constructed{std::forward<decltype(initializers)>(initializers)...};
+    });
+  }
+
+  template <typename Container>
+  constexpr auto create_shared(Container& container) const
+      -> std::shared_ptr<Constructed> {
+    return initialize(container, [](auto&&... initializers) {
+      return std::make_shared<Constructed>(
+          std::forward<decltype(initializers)>(initializers)...);
+    });
+  }
+
+  template <typename Container>
+  constexpr auto create_unique(Container& container) const
+      -> std::unique_ptr<Constructed> {
+    return initialize(container, [](auto&&... initializers) {
+      return std::make_unique<Constructed>(
+          std::forward<decltype(initializers)>(initializers)...);
+    });
+  }
+
+  template <typename Node, typename Container>
+  constexpr auto create_tree_node(Container& container) const -> Node {
+    return invoker::create_tree_node<Node, Constructed>(
+        container,
+        [&](void* address) {
+          return initialize(container, [&](auto&&... initializers) {
+            return ::new (address) Constructed{
+                std::forward<decltype(initializers)>(initializers)...};
+          });
+        },
+        [&] { return create_unique(container); });
+  }
+
+  template <typename Poly, typename Container>
+  constexpr auto create_inline_poly(Container& container) const -> Poly {
+    return initialize(container, [](auto&&... initializers) {
+      return Poly{std::in_place_type<Constructed>,
+                  std::forward<decltype(initializers)>(initializers)...};
+    });
+  }
+
+  template <typename Requested, typename Container>
+  constexpr auto create(Container& container) const
+      noexcept(is_nothrow_create<Requested, Container>()) -> auto {
+    invoker::check<FieldInvoker>(container);
+    auto&& constructing = cycle::enter<Constructed>(container);
+    if constexpr (meta::IsTreeUniquePtr<Requested>) {
+      return create_tree_node<std::remove_cvref_t<Requested>>(constructing);
+    } else if constexpr (meta::IsSharedPtr<Requested>) {
+      return create_shared(constructing);
+    } else if constexpr (meta::IsUniquePtr<Requested>) {
+      return create_unique(constructing);
+    } else if constexpr (meta::IsInlinePoly<Requested>) {
+      return create_inline_poly<std::remove_cvref_t<Requested>>(constructing);
+    } else {
+      return create_value(constructing);
+    }
+  }
+
+ private:
+  //! Number of fields of Constructed.
+  //
+  // This and the other layout queries are functions, so they are only
+  // evaluated once Constructed is complete, even if it is nested.
+  static constexpr auto num_fields() noexcept -> std::size_t {
+    return arity<Constructed>;
+  }
+
+  //! Position of a named field among Constructed's fields.
+  template <auto field>
+  static constexpr auto position() noexcept -> std::size_t {
+    return aggregate::position<field, num_fields()>;
+  }
+
+  //! Number of initializers; one per field up to the last named field.
+  static constexpr auto num_initializers() noexcept -> std::size_t {
+    auto result = std::size_t{0};
+    ((result = position<fields>() < result ? result : position<fields>() + 1),
+     ...);
+    return result;
+  }
+
+  //! Index in fields of the field at position, or sizeof...(fields).
+  static constexpr auto named_index(std::size_t position) noexcept
+      -> std::size_t {
+    auto result = std::size_t{0};
+    ((FieldInvoker::position<fields>() == position || (++result, false)) ||
+     ...);
+    return result;
+  }
+
+  //! true if no two of fields name the same field.
+  static constexpr auto is_named_once() noexcept -> bool {
+    auto index = std::size_t{0};
+    return ((named_index(position<fields>()) == index++) && ...);
+  }
+
+  //! true if any field before the last named field is not named.
+  static constexpr auto needs_prototype() noexcept -> bool {
+    return num_initializers() > sizeof...(fields);
+  }
+
+  //! References to each field of prototype, to move from.
+  static constexpr auto fields_of(Constructed& prototype) noexcept {
+    return aggregate::visit_fields<num_fields()>(
+        prototype, [](auto&&... values) noexcept {
+          return std::forward_as_tuple(
+              std::forward<decltype(values)>(values)...);
+        });
+  }
+
+  //! References to the fields of a prototype, if there is one.
+  using Defaults =
+      std::conditional_t<needs_prototype(),
+                         decltype(fields_of(std::declval<Constructed&>())),
+                         std::tuple<>>;
+
+  //! Initializer of the field at position.
+  //
+  // Named fields are initialized by resolvers that only convert to the field's
+  // type, so the resolved instance initializes the field directly.
+  template <std::size_t position, typename Container>
+  static constexpr auto initializer(Container& container,
+                                    Defaults& defaults) noexcept
+      -> decltype(auto) {
+    if constexpr (constexpr auto index = named_index(position);
+                  index < sizeof...(fields)) {
+      using Field = std::tuple_element_t<
+          index, std::tuple<std::remove_cv_t<meta::MemberType<fields>>...>>;
+      return DeclaredResolver<Field, Container>{container};
+    } else {
+      return std::forward<std::tuple_element_t<position, Defaults>>(
+          std::get<position>(defaults));
+    }
+  }
+
+  //! Type of the initializer of the field at position.
+  template <std::size_t position, typename Container>
+  using Initializer = decltype(initializer<position>(
+      std::declval<Container&>(), std::declval<Defaults&>()));
+
+  //! Calls construct with the initializer of each field, in order.
+  template <typename Container, typename Construct>
+  static constexpr auto initialize(Container& container, Construct construct)
+      -> decltype(auto) {
+    static_assert(((position<fields>() < num_fields()) && ...),
+                  "InjectFields could not find a field among the aggregate's "
+                  "fields; arrays and bit-fields are not supported.");
+    static_assert(is_named_once(), "InjectFields names a field twice.");
+    const auto with = [&]<std::size_t... positions>(
+                          Defaults defaults, std::index_sequence<positions...>)
+        -> decltype(auto) {
+      return construct(initializer<positions>(container, defaults)...);
+    };
+
+    constexpr auto sequence = std::make_index_sequence<num_initializers()>{};
+    if constexpr (needs_prototype()) {
+      static_assert(std::is_default_constructible_v<Constructed>,
+                    "InjectFields moves fields that aren't injected from a "
+                    "value-initialized instance when they precede injected "
+                    "fields, so it must be value-initializable.");
+      auto prototype = Constructed{};
+      return with(fields_of(prototype), sequence);
+    } else {
+      return with(Defaults{}, sequence);
+    }
+  }
+
+  //! true if initializing every field cannot throw.
+  //
+  // Constructed{} is only named once it is known to be valid, so initialize()
+  // reports the requirement instead.
+  template <typename Container, std::size_t... positions>
+  static constexpr auto is_nothrow_initialize(
+      std::index_sequence<positions...>) noexcept -> bool {
+    constexpr auto nothrow_fields = noexcept(
+        Constructed{std::declval<Initializer<positions, Container>>()...});
+    if constexpr (!needs_prototype()) {
+      return nothrow_fields;
+    } else if constexpr (std::is_default_constructible_v<Constructed>) {
+      return nothrow_fields && noexcept(Constructed{});
+    } else {
+      return false;
+    }
+  }
+
+  template <typename Container>
+  static constexpr auto is_nothrow_value() noexcept -> bool {
+    return is_nothrow_initialize<Container>(
+        std::make_index_sequence<num_initializers()>{});
+  }
+
+  //! true if create() cannot throw; pointers allocate, so they always can.
+  template <typename Requested, typename Container>
+  static constexpr auto is_nothrow_create() noexcept -> bool {
+    using Entered = cycle::Entered<Constructed, Container>;
+    if constexpr (meta::IsTreeUniquePtr<Requested> ||
+                  meta::IsSharedPtr<Requested> ||
+                  meta::IsUniquePtr<Requested>) {
+      return false;
+    } else if constexpr (meta::IsInlinePoly<Requested>) {
+      return is_nothrow_value<Entered>() &&
+             std::remove_cvref_t<Requested>::template fits_inline<Constructed>;
+    } else {
+      return is_nothrow_value<Entered>();
+    }
+  }
 };
 
 //! Creates invokers.
@@ -141,14 +540,34 @@ template <template <typename Constructed, typename ConstructedFactory,
           typename ResolverSequenceFactory = ResolverSequenceFactory<>>
 class InvokerFactory {
  public:
+  //! Creates an invoker for ConstructedFactory, or Constructed's ctor if void.
+  //
+  // If Constructed declares its injection ctor, its parameters are resolved
+  // exactly as declared, and if it declares injected fields, only those fields
+  // are resolved. Either way, no arity search is performed.
   template <typename Constructed, typename ConstructedFactory>
-  constexpr auto create() -> auto {
-    using ResolverSequence =
-        std::remove_reference_t<decltype(resolver_sequence_factory_.create())>;
-    return Invoker<
-        Constructed, ConstructedFactory, ResolverSequence,
-        std::make_index_sequence<arity<Constructed, ConstructedFactory>>>{
-        resolver_sequence_factory_.create()};
+  constexpr auto create() noexcept(
+      noexcept(std::declval<ResolverSequenceFactory&>().create())) -> auto {
+    if constexpr (std::same_as<ConstructedFactory, void> &&
+                  DeclaresInjectedFields<Constructed>) {
+      return FieldInvoker<Constructed, InjectSignature<Constructed>>{};
+    } else if constexpr (std::same_as<ConstructedFactory, void> &&
+                         DeclaresInjection<Constructed>) {
+      using Signature = InjectSignature<Constructed>;
+      using ResolverSequence = std::remove_reference_t<
+          decltype(resolver_sequence_factory_
+                       .template create_declared<Signature>())>;
+      return Invoker<Constructed, void, ResolverSequence,
+                     std::make_index_sequence<inject_arity<Constructed>>>{
+          resolver_sequence_factory_.template create_declared<Signature>()};
+    } else {
+      using ResolverSequence = std::remove_reference_t<
+          decltype(resolver_sequence_factory_.create())>;
+      return Invoker<
+          Constructed, ConstructedFactory, ResolverSequence,
+          std::make_index_sequence<arity<Constructed, ConstructedFactory>>>{
+          resolver_sequence_factory_.create()};
+    }
   }
 
   explicit constexpr InvokerFactory(
@@ -165,6 +165,93 @@ TEST_F(InvokerTestFactoryRunTime, Arity3UniquePtr) {
       container, constructed_factory));
 }
 
+// ----------------------------------------------------------------------------
+// FieldInvoker
+// ----------------------------------------------------------------------------
+
+struct FieldInvokerTest : Test {
+  static constexpr auto kDefault = int_t{3};    // Arbitrary.
+  static constexpr auto kResolved = int_t{11};  // Arbitrary.
+
+  // Resolves every int_t as kResolved and every pointer as a local address.
+  struct Container {
+    int_t instance = 0;
+
+    template <typename Requested>
+    constexpr auto resolve() -> Requested {
+      if constexpr (std::is_pointer_v<Requested>) {
+        return &instance;
+      } else {
+        return kResolved;
+      }
+    }
+  };
+  Container container;
+
+  struct Constructed {
+    int_t injected;
+    int_t defaulted = kDefault;
+    int_t* pointer;
+  };
+
+  using Sut = FieldInvoker<Constructed, InjectFields<&Constructed::injected,
+                                                     &Constructed::pointer>>;
+  Sut sut;
+
+  auto test_result(const Constructed& constructed) const -> void {
+    EXPECT_EQ(kResolved, constructed.injected);
+    EXPECT_EQ(kDefault, constructed.defaulted);
+    EXPECT_EQ(&container.instance, constructed.pointer);
+  }
+};
+
+TEST_F(FieldInvokerTest, Value) {
+  test_result(sut.template create<Constructed>(container));
+}
+
+TEST_F(FieldInvokerTest, SharedPtr) {
+  test_result(*sut.template create<std::shared_ptr<Constructed>>(container));
+}
+
+TEST_F(FieldInvokerTest, UniquePtr) {
+  test_result(*sut.template create<std::unique_ptr<Constructed>>(container));
+}
+
+// Named fields are initialized in place, so they may be const or immovable.
+struct FieldInvokerTestInPlace : FieldInvokerTest {
+  struct Immovable {
+    int_t value;
+
+    Immovable(int_t value) : value{value} {}
+    Immovable(const Immovable&) = delete;
+  };
+
+  struct Constructed {
+    const Immovable injected;
+    const int_t& trailing = kDefault;
+  };
+
+  using Sut = FieldInvoker<Constructed, InjectFields<&Constructed::injected>>;
+  Sut sut;
+
+  auto test_result(const Constructed& constructed) const -> void {
+    EXPECT_EQ(kResolved, constructed.injected.value);
+    EXPECT_EQ(&kDefault, &constructed.trailing);
+  }
+};
+
+TEST_F(FieldInvokerTestInPlace, Value) {
+  test_result(sut.template create<Constructed>(container));
+}
+
+TEST_F(FieldInvokerTestInPlace, SharedPtr) {
+  test_result(*sut.template create<std::shared_ptr<Constructed>>(container));
+}
+
+TEST_F(FieldInvokerTestInPlace, UniquePtr) {
+  test_result(*sut.template create<std::unique_ptr<Constructed>>(container));
+}
+
 // ----------------------------------------------------------------------------
 // InvokerFactory
 // ----------------------------------------------------------------------------
@@ -217,6 +304,9 @@ struct SpyInvoker<Constructed, ConstructedFactory, ResolverSequence,
 struct InvokerFactoryFixture {
   struct ResolverSequence {};
 
+  template <typename Signature>
+  struct DeclaredResolverSequence {};
+
   struct Constructed0 {
   };
   struct Constructed1 {
@@ -248,13 +338,32 @@ struct InvokerFactoryFixture {
     }
   };
 
+  // Declares a ctor other than its greediest.
+  struct DeclaredConstructed {
+    using dink_inject = DeclaredConstructed(int_t, int_t&);
+    DeclaredConstructed(int_t, int_t&);
+    DeclaredConstructed(int_t, int_t, int_t);
+  };
+
+  // Declares injected fields.
+  struct FieldsConstructed {
+    int_t injected;
+    int_t defaulted;
+    using dink_inject = InjectFields<&FieldsConstructed::injected>;
+  };
+
+  struct DeclaredConstructedFactory {
+    constexpr auto operator()(int_t) const noexcept -> DeclaredConstructed;
+  };
+
   template <typename Constructed, typename ConstructedFactory,
             typename ResolverSequence, typename IndexSequence>
   using Invoker = SpyInvoker<Constructed, ConstructedFactory, ResolverSequence,
                              IndexSequence>;
 
-  using Sut =
-      InvokerFactory<Invoker, ResolverSequenceFactory<ResolverSequence>>;
+  using Sut = InvokerFactory<
+      Invoker,
+      ResolverSequenceFactory<ResolverSequence, DeclaredResolverSequence>>;
 };
 
 // Compile-Time Tests: Type Correctness and Arity
@@ -287,6 +396,20 @@ struct InvokerFactoryCompileTimeTest : InvokerFactoryFixture {
     static_assert(Expected::arity == expected_arity);
   }
 
+  // Tests that declared ctors resolve their declared params
+  template <typename Constructed, std::size_t expected_arity>
+  static constexpr auto test_declared_ctor_type() {
+    using Actual =
+        decltype(std::declval<Sut>().template create<Constructed, void>());
+    using Expected =
+        Invoker<Constructed, void,
+                DeclaredResolverSequence<InjectSignature<Constructed>>,
+                std::make_index_sequence<expected_arity>>;
+
+    static_assert(std::same_as<Actual, Expected>);
+    static_assert(Expected::arity == expected_arity);
+  }
+
   constexpr InvokerFactoryCompileTimeTest() {
     // Ctor specializations
     test_ctor_type<Constructed0, 0>();
@@ -297,6 +420,17 @@ struct InvokerFactoryCompileTimeTest : InvokerFactoryFixture {
     test_factory_type<Constructed0, ConstructedFactory0, 0>();
     test_factory_type<Constructed1, ConstructedFactory1, 1>();
     test_factory_type<Constructed3, ConstructedFactory3, 3>();
+
+    // Declared ctors bypass search; their factories do not.
+    test_declared_ctor_type<DeclaredConstructed, 2>();
+    test_factory_type<DeclaredConstructed, DeclaredConstructedFactory, 1>();
+
+    // Declared fields bypass search.
+    static_assert(std::same_as<
+                  FieldInvoker<FieldsConstructed,
+                               InjectFields<&FieldsConstructed::injected>>,
+                  decltype(std::declval<Sut>()
+                               .template create<FieldsConstructed, void>())>);
   }
 };
 [[maybe_unused]] constexpr auto invoker_factory_compile_time_test =
@@ -0,0 +1,205 @@
+// \file
+// Copyright (c) 2025 Frank Secilia
+// SPDX-License-Identifier: MIT
+//
+// \brief Injectable wrapper that defers resolution until first use.
+
+#pragma once
+
+#include <dink/lib.hpp>
+#include <dink/canonical.hpp>
+#include <dink/emplacer.hpp>
+#include <dink/fwd.hpp>
+#include <dink/handle.hpp>
+#include <dink/meta.hpp>
+#include <concepts>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <type_traits>
+#include <utility>
+
+namespace dink {
+
+namespace lazy::detail {
+
+//! References are stored by address; everything else is stored in place.
+template <typename Requested>
+using Stored =
+    std::conditional_t<std::is_lvalue_reference_v<Requested>,
+                       std::remove_reference_t<Requested>*,
+                       std::remove_cv_t<meta::RemoveRvalueRef<Requested>>>;
+
+//! Resolves Requested from container into stored.
+template <typename Requested, typename Container>
+auto resolve_into(Container& container,
+                  std::optional<Stored<Requested>>& stored) -> void {
+  if constexpr (std::is_lvalue_reference_v<Requested>) {
+    stored.emplace(std::addressof(container.template resolve<Requested>()));
+  } else {
+    stored.emplace(Emplacer<Requested, Container>{container});
+  }
+}
+
+//! Refers to the container a Lazy resolves from.
+//
+// This holds a typed pointer, so resolving is a direct, inlinable call.
+template <typename Requested, typename Container>
+class ContainerRef {
+ public:
+  auto resolve_into(std::optional<Stored<Requested>>& stored) const -> void {
+    detail::resolve_into<Requested>(*container_, stored);
+  }
+
+  explicit constexpr ContainerRef(Container& container) noexcept
+      : container_{std::addressof(container)} {}
+
+ private:
+  Container* container_;
+};
+
+//! Specialization for AnyContainer refers to any container.
+template <typename Requested>
+class ContainerRef<Requested, AnyContainer> {
+ public:
+  auto resolve_into(std::optional<Stored<Requested>>& stored) const -> void {
+    resolve_(container_, stored);
+  }
+
+  template <typename Container>
+    requires(!std::same_as<std::remove_cvref_t<Container>, ContainerRef>)
+  explicit constexpr ContainerRef(Container& container) noexcept
+      : container_{std::addressof(container)},
+        resolve_{&resolve_from<Container>} {}
+
+ private:
+  using ResolveFunction =
+      auto (*)(void* container, std::optional<Stored<Requested>>& stored)
+          -> void;
+
+  //! Resolves from the concrete container type into storage.
+  template <typename Container>
+  static auto resolve_from(void* container,
+                           std::optional<Stored<Requested>>& stored) -> void {
+    detail::resolve_into<Requested>(*static_cast<Container*>(container),
+                                    stored);
+  }
+
+  void* container_;
+  ResolveFunction resolve_;
+};
+
+}  // namespace lazy::detail
+
+// ----------------------------------------------------------------------------
+// Lazy
+// ----------------------------------------------------------------------------
+
+//! Resolves Requested from a container the first time it is accessed.
+//
+// Injecting Lazy<Requested, Container> instead of Requested defers
+// construction of the requested instance, and its whole dependency subgraph,
+// until the consumer actually uses it. Requested may be any form the container
+// can resolve, e.g. Lazy<Service&, App>, Lazy<std::shared_ptr<Service>, App>,
+// or Lazy<Service, App>.
+//
+// Lazy is injectable from the container named by Container, or from any
+// container if that is AnyContainer. After initialization, access is a
+// once-flag check and a load.
+//
+// Initialization is thread-safe. Lazy is logically const, so accessors are
+// const even though the first access mutates it.
+template <typename Requested, typename Container>
+class Lazy {
+ public:
+  //! Type produced by resolving Requested.
+  using Resolved = meta::RemoveRvalueRef<Requested>;
+
+  //! Resolves on first call, then returns the same instance.
+  auto get() const -> Resolved& {
+    std::call_once(once_, [this] { container_.resolve_into(stored_); });
+    if constexpr (kResolvesReference) {
+      return **stored_;
+    } else {
+      return *stored_;
+    }
+  }
+
+  //! Dereferences the resolved instance, or the pointer it holds.
+  auto operator*() const -> decltype(auto) {
+    if constexpr (kResolvesPointerLike) {
+      return *get();
+    } else {
+      return get();
+    }
+  }
+
+  //! Accesses members of the resolved instance.
+  auto operator->() const -> auto {
+    if constexpr (kResolvesPointerLike) {
+      return std::to_address(get());
+    } else {
+      return std::addressof(get());
+    }
+  }
+
+  //! Binds to a container without resolving anything yet.
+  template <typename Source>
+    requires(!std::same_as<std::remove_cvref_t<Source>, Lazy> &&
+             std::constructible_from<
+                 lazy::detail::ContainerRef<Requested, Container>, Source&>)
+  explicit Lazy(Source& container) noexcept : container_{container} {}
+
+  //! Transfers the binding and, if present, the resolved instance.
+  //
+  // Moving is not synchronized with concurrent first access to src.
+  Lazy(Lazy&& src) noexcept(std::is_nothrow_move_constructible_v<Stored>)
+      : container_{src.container_} {
+    if (src.stored_.has_value()) {
+      std::call_once(once_, [&] { stored_.emplace(std::move(*src.stored_)); });
+    }
+  }
+
+  Lazy(const Lazy&) = delete;
+  auto operator=(const Lazy&) -> Lazy& = delete;
+  auto operator=(Lazy&&) -> Lazy& = delete;
+
+ private:
+  static constexpr auto kResolvesReference =
+      std::is_lvalue_reference_v<Requested>;
+  static constexpr auto kResolvesPointerLike =
+      std::is_pointer_v<Resolved> || meta::IsSharedPtr<Resolved> ||
+      meta::IsUniquePtr<Resolved> || meta::IsInlinePoly<Resolved>;
+
+  using Stored = lazy::detail::Stored<Requested>;
+
+  lazy::detail::ContainerRef<Requested, Container> container_;
+  mutable std::once_flag once_{};
+  mutable std::optional<Stored> stored_{};
+};
+
+// ----------------------------------------------------------------------------
+// Concepts
+// ----------------------------------------------------------------------------
+
+namespace traits {
+
+//! Lazy is a handle; it is created from the requesting container.
+template <typename Requested, typename Container>
+struct IsHandle<Lazy<Requested, Container>> : std::true_type {};
+
+}  // namespace traits
+
+// ----------------------------------------------------------------------------
+// Canonical
+// ----------------------------------------------------------------------------
+
+namespace canonical::detail {
+
+//! Removes Lazy.
+template <typename Requested, typename Container>
+struct Canonical<Lazy<Requested, Container>> : Canonical<Requested> {};
+
+}  // namespace canonical::detail
+
+}  // namespace dink
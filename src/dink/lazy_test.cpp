@@ -0,0 +1,148 @@
+// \file
+// Copyright (c) 2025 Frank Secilia
+// SPDX-License-Identifier: MIT
+
+#include "lazy.hpp"
+#include <dink/test.hpp>
+#include <atomic>
+#include <thread>
+#include <vector>
+
+namespace dink {
+namespace {
+
+struct LazyTest : Test {
+  static constexpr auto kInitialValue = int_t{4723};  // Arbitrary.
+
+  struct Resolved {
+    int_t value = kInitialValue;
+  };
+
+  // Counts resolves and returns a cached instance or a new value.
+  struct Container {
+    std::atomic<int_t> num_resolves = 0;
+    Resolved instance{};
+
+    template <typename Requested>
+    auto resolve() -> meta::RemoveRvalueRef<Requested> {
+      ++num_resolves;
+      if constexpr (std::is_lvalue_reference_v<Requested>) {
+        return instance;
+      } else if constexpr (meta::IsSharedPtr<Requested>) {
+        return std::make_shared<Resolved>();
+      } else {
+        return Resolved{};
+      }
+    }
+  };
+  Container container;
+};
+
+// Canonical strips Lazy and whatever it wraps.
+static_assert(
+    std::same_as<Canonical<Lazy<LazyTest::Resolved, LazyTest::Container>>,
+                 LazyTest::Resolved>);
+static_assert(std::same_as<
+              Canonical<Lazy<const LazyTest::Resolved&, AnyContainer>>,
+              LazyTest::Resolved>);
+static_assert(
+    std::same_as<Canonical<Lazy<std::shared_ptr<LazyTest::Resolved>,
+                                LazyTest::Container>>,
+                 LazyTest::Resolved>);
+
+static_assert(IsHandle<Lazy<int_t, LazyTest::Container>>);
+static_assert(IsHandle<const Lazy<int_t, AnyContainer>&>);
+static_assert(!IsHandle<int_t>);
+
+// The typed form only binds to its own container; AnyContainer binds to any.
+static_assert(std::constructible_from<Lazy<int_t, LazyTest::Container>,
+                                      LazyTest::Container&>);
+static_assert(!std::constructible_from<Lazy<int_t, LazyTest::Container>,
+                                       LazyTest::Resolved&>);
+static_assert(std::constructible_from<Lazy<int_t, AnyContainer>,
+                                      LazyTest::Container&>);
+
+// The typed form holds only the container pointer beside its state.
+static_assert(sizeof(Lazy<LazyTest::Resolved&, LazyTest::Container>) <
+              sizeof(Lazy<LazyTest::Resolved&, AnyContainer>));
+
+TEST_F(LazyTest, does_not_resolve_until_accessed) {
+  [[maybe_unused]] const auto sut = Lazy<Resolved&, Container>{container};
+
+  ASSERT_EQ(0, container.num_resolves);
+}
+
+TEST_F(LazyTest, resolves_reference_once) {
+  auto sut = Lazy<Resolved&, Container>{container};
+
+  auto& first = sut.get();
+  auto& second = *sut;
+
+  ASSERT_EQ(1, container.num_resolves);
+  ASSERT_EQ(&container.instance, &first);
+  ASSERT_EQ(&container.instance, &second);
+}
+
+TEST_F(LazyTest, resolves_value_in_place) {
+  const auto sut = Lazy<Resolved, Container>{container};
+
+  ASSERT_EQ(kInitialValue, sut->value);
+  ASSERT_EQ(&sut.get(), &*sut);
+  ASSERT_EQ(1, container.num_resolves);
+}
+
+TEST_F(LazyTest, dereferences_through_shared_ptr) {
+  auto sut = Lazy<std::shared_ptr<Resolved>, Container>{container};
+
+  ASSERT_EQ(kInitialValue, sut->value);
+  ASSERT_EQ(sut.get().get(), &*sut);
+  ASSERT_EQ(1, container.num_resolves);
+}
+
+TEST_F(LazyTest, move_transfers_resolved_instance) {
+  auto src = Lazy<Resolved, Container>{container};
+  const auto* const resolved = &src.get();
+
+  auto sut = Lazy<Resolved, Container>{std::move(src)};
+
+  ASSERT_EQ(kInitialValue, sut->value);
+  ASSERT_NE(resolved, &sut.get());
+  ASSERT_EQ(1, container.num_resolves);
+}
+
+TEST_F(LazyTest, move_before_access_defers_resolution) {
+  auto src = Lazy<Resolved&, Container>{container};
+
+  auto sut = Lazy<Resolved&, Container>{std::move(src)};
+  ASSERT_EQ(0, container.num_resolves);
+
+  ASSERT_EQ(&container.instance, &sut.get());
+  ASSERT_EQ(1, container.num_resolves);
+}
+
+TEST_F(LazyTest, any_container_resolves_through_erased_container) {
+  auto sut = Lazy<Resolved&, AnyContainer>{container};
+  ASSERT_EQ(0, container.num_resolves);
+
+  ASSERT_EQ(&container.instance, &sut.get());
+  ASSERT_EQ(&container.instance, &sut.get());
+  ASSERT_EQ(1, container.num_resolves);
+}
+
+TEST_F(LazyTest, concurrent_first_access_resolves_once) {
+  static constexpr auto kNumThreads = 8;
+  auto sut = Lazy<Resolved, Container>{container};
+
+  auto threads = std::vector<std::thread>{};
+  auto results = std::vector<Resolved*>(kNumThreads);
+  for (auto index = 0; index < kNumThreads; ++index) {
+    threads.emplace_back([&, index] { results[index] = &sut.get(); });
+  }
+  for (auto& thread : threads) thread.join();
+
+  ASSERT_EQ(1, container.num_resolves);
+  for (auto* result : results) ASSERT_EQ(&sut.get(), result);
+}
+
+}  // namespace
+}  // namespace dink
@@ -33,6 +33,31 @@ namespace dink {
   #endif
 #endif
 
+// ----------------------------------------------------------------------------
+// dink_noinline, dink_cold
+//
+// dink_noinline keeps a function out of line. dink_cold also marks it as
+// rarely called, so one-time work stays out of the hot path of its callers.
+// ----------------------------------------------------------------------------
+
+#if !defined dink_noinline
+  #if defined __GNUC__ || defined __clang__
+    #define dink_noinline gnu::noinline
+  #elif defined _MSC_VER && _MSC_VER >= 1930
+    #define dink_noinline msvc::noinline
+  #else
+    #define dink_noinline
+  #endif
+#endif
+
+#if !defined dink_cold
+  #if defined __GNUC__ || defined __clang__
+    #define dink_cold gnu::cold, dink_noinline
+  #else
+    #define dink_cold dink_noinline
+  #endif
+#endif
+
 // clang-format on
 
 // ----------------------------------------------------------------------------
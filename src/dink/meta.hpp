@@ -7,6 +7,7 @@
 #pragma once
 
 #include <dink/lib.hpp>
+#include <dink/fwd.hpp>
 #include <concepts>
 #include <memory>
 #include <type_traits>
@@ -92,6 +93,49 @@ constexpr bool is_unique_ptr = IsUniquePtr<Type>::value;
 template <typename Type>
 concept IsUniquePtr = traits::is_unique_ptr<std::remove_cvref_t<Type>>;
 
+// ----------------------------------------------------------------------------
+// IsTreeUniquePtr
+// ----------------------------------------------------------------------------
+
+namespace traits {
+
+template <typename>
+struct IsTreeUniquePtr : std::false_type {};
+
+template <typename Element>
+struct IsTreeUniquePtr<std::unique_ptr<Element, tree::Deleter>>
+    : std::true_type {};
+
+template <typename Type>
+constexpr bool is_tree_unique_ptr = IsTreeUniquePtr<Type>::value;
+
+}  // namespace traits
+
+template <typename Type>
+concept IsTreeUniquePtr =
+    traits::is_tree_unique_ptr<std::remove_cvref_t<Type>>;
+
+// ----------------------------------------------------------------------------
+// IsInlinePoly
+// ----------------------------------------------------------------------------
+
+namespace traits {
+
+template <typename>
+struct IsInlinePoly : std::false_type {};
+
+template <typename Interface, std::size_t capacity, std::size_t alignment>
+struct IsInlinePoly<InlinePoly<Interface, capacity, alignment>>
+    : std::true_type {};
+
+template <typename Type>
+constexpr bool is_inline_poly = IsInlinePoly<Type>::value;
+
+}  // namespace traits
+
+template <typename Type>
+concept IsInlinePoly = traits::is_inline_poly<std::remove_cvref_t<Type>>;
+
 // ----------------------------------------------------------------------------
 // IsWeakPtr
 // ----------------------------------------------------------------------------
@@ -136,6 +180,34 @@ struct RemoveRvalueRef<Type&&> {
 template <typename Type>
 using RemoveRvalueRef = typename traits::RemoveRvalueRef<Type>::type;
 
+// ----------------------------------------------------------------------------
+// MemberType
+// ----------------------------------------------------------------------------
+
+namespace traits {
+
+template <typename MemberPtr>
+struct MemberType;
+
+template <typename Class, typename Member>
+struct MemberType<Member Class::*> {
+  using type = Member;
+  using class_type = Class;
+};
+
+}  // namespace traits
+
+//! Type of the data member pointed to by member_ptr.
+template <auto member_ptr>
+using MemberType = typename traits::MemberType<decltype(member_ptr)>::type;
+
+//! Class whose data member member_ptr points to.
+//
+// For an inherited member, this is the base that declares it.
+template <auto member_ptr>
+using MemberClass =
+    typename traits::MemberType<decltype(member_ptr)>::class_type;
+
 // ----------------------------------------------------------------------------
 // UniqueType
 // ----------------------------------------------------------------------------
@@ -13,6 +13,7 @@ struct Deleter {};
 using SharedPtr = std::shared_ptr<Element>;
 using WeakPtr = std::weak_ptr<Element>;
 using UniquePtr = std::unique_ptr<Element, Deleter>;
+using Poly = InlinePoly<Element, sizeof(Element)>;
 
 // ----------------------------------------------------------------------------
 // shared_ptr
@@ -79,6 +80,29 @@ static_assert(IsUniquePtr<UniquePtr&>);
 static_assert(IsUniquePtr<const UniquePtr&>);
 static_assert(IsUniquePtr<UniquePtr&&>);
 
+// ----------------------------------------------------------------------------
+// InlinePoly
+// ----------------------------------------------------------------------------
+
+// Trait Variable Template
+// ----------------------------------------------------------------------------
+static_assert(!traits::is_inline_poly<void>);
+static_assert(!traits::is_inline_poly<Element>);
+static_assert(!traits::is_inline_poly<UniquePtr>);
+static_assert(traits::is_inline_poly<Poly>);
+
+static_assert(!traits::is_inline_poly<const Poly>);
+static_assert(!traits::is_inline_poly<Poly&&>);
+
+// Concept
+// ----------------------------------------------------------------------------
+static_assert(!IsInlinePoly<Element>);
+static_assert(!IsInlinePoly<UniquePtr>);
+static_assert(IsInlinePoly<Poly>);
+
+static_assert(IsInlinePoly<const Poly&>);
+static_assert(IsInlinePoly<Poly&&>);
+
 // ----------------------------------------------------------------------------
 // weak_ptr
 // ----------------------------------------------------------------------------
@@ -134,6 +158,29 @@ static_assert(std::is_same_v<RemoveRvalueRef<int*&>, int*&>);
 static_assert(std::is_same_v<RemoveRvalueRef<int*&&>, int*>);
 static_assert(std::is_same_v<RemoveRvalueRef<const int*&&>, const int*>);
 
+// ----------------------------------------------------------------------------
+// MemberType and MemberClass
+// ----------------------------------------------------------------------------
+
+struct Members {
+  int value;
+  const int const_value;
+  int* pointer;
+};
+
+static_assert(std::is_same_v<MemberType<&Members::value>, int>);
+static_assert(std::is_same_v<MemberType<&Members::const_value>, const int>);
+static_assert(std::is_same_v<MemberType<&Members::pointer>, int*>);
+
+struct DerivedMembers : Members {
+  int derived_value;
+};
+
+static_assert(std::is_same_v<MemberClass<&Members::value>, Members>);
+static_assert(std::is_same_v<MemberClass<&DerivedMembers::derived_value>,
+                             DerivedMembers>);
+static_assert(std::is_same_v<MemberClass<&DerivedMembers::value>, Members>);
+
 // ----------------------------------------------------------------------------
 // UniqueType
 // ----------------------------------------------------------------------------
@@ -0,0 +1,56 @@
+// \file
+// Copyright (c) 2025 Frank Secilia
+// SPDX-License-Identifier: MIT
+//
+// Consumes the dink module rather than its headers, so the exported names are
+// checked to be enough to write an ordinary application.
+
+#include <gtest/gtest.h>
+#include <memory>
+#include <utility>
+
+import dink;
+
+namespace {
+
+constexpr auto kId = dink::int_t{8231};  // Arbitrary.
+
+struct Logger {};
+
+struct Service {
+  using dink_inject = Service(Logger&, dink::int_t);
+  Service(Logger& logger, dink::int_t id) : logger{logger}, id{id} {}
+  Logger& logger;
+  dink::int_t id;
+};
+
+struct Client {
+  explicit Client(std::shared_ptr<Service> service)
+      : service{std::move(service)} {}
+  std::shared_ptr<Service> service;
+};
+
+TEST(ModuleTest, resolves_graph_through_imported_names) {
+  auto sut = dink::Container{dink::bind<Logger>().in<dink::scope::Singleton>(),
+                             dink::bind<dink::int_t>().via([] { return kId; })};
+
+  const auto client = sut.resolve<Client>();
+
+  EXPECT_EQ(kId, client.service->id);
+  EXPECT_EQ(&sut.resolve<Logger&>(), &client.service->logger);
+}
+
+TEST(ModuleTest, creates_handles_through_imported_names) {
+  auto sut = dink::Container{dink::bind<Logger>().in<dink::scope::Singleton>()};
+  using App = decltype(sut);
+
+  auto lazy = sut.resolve<dink::Lazy<Logger&, App>>();
+  const auto provider = sut.resolve<dink::Provider<Logger&, App>>();
+  const auto factory =
+      sut.resolve<dink::AssistedFactory<Service(dink::int_t), App>>();
+
+  EXPECT_EQ(&lazy.get(), &provider());
+  EXPECT_EQ(kId, factory(kId).id);
+}
+
+}  // namespace
@@ -0,0 +1,108 @@
+// \file
+// Copyright (c) 2025 Frank Secilia
+// SPDX-License-Identifier: MIT
+//
+// \brief Several bindings contributing to one compile-time set.
+//
+// Multibindings are bound with a SetOf<Element> key:
+//
+//   auto container = Container{
+//       bind<SetOf<Handler>>().as<JsonHandler>(),
+//       bind<SetOf<Handler>>().as<XmlHandler>().in<scope::Singleton>(),
+//   };
+//
+// The set is resolved either as a tuple of references to the concrete types,
+// container.resolve_set<Handler>(), or as a span over a contiguous array of
+// element pointers, container.resolve<std::span<Handler* const>>(). In both
+// cases, the number of elements is known at compile time. The span form is
+// injectable; the tuple form lets the dispatch loop be unrolled over concrete
+// types with std::apply.
+//
+// Each element is resolved as a reference using its own binding's scope and
+// provider, so transient bindings are promoted to singletons, as they are when
+// any other transient is requested by reference.
+
+#pragma once
+
+#include <dink/lib.hpp>
+#include <dink/meta.hpp>
+#include <array>
+#include <cstddef>
+#include <span>
+#include <tuple>
+#include <type_traits>
+
+namespace dink {
+
+// ----------------------------------------------------------------------------
+// SetOf
+// ----------------------------------------------------------------------------
+
+//! Binding key for contributions to the set of Element.
+//
+// SetOf is only a key; it is never constructed. Each binding for SetOf must
+// use .as<To>() or .to(instance) to name the contributed type.
+template <typename Element>
+struct SetOf {
+  SetOf() = delete;
+};
+
+// ----------------------------------------------------------------------------
+// Concepts
+// ----------------------------------------------------------------------------
+
+namespace traits {
+
+//! Matches span of const pointers, the injectable form of a set.
+template <typename Requested>
+struct IsSetSpan : std::false_type {};
+
+template <typename Element, std::size_t extent>
+struct IsSetSpan<std::span<Element* const, extent>> : std::true_type {};
+
+template <typename Requested>
+inline constexpr auto is_set_span = IsSetSpan<Requested>::value;
+
+}  // namespace traits
+
+//! Matches requests for a set as a span of element pointers.
+//
+// Only values are matched; the span is a view, so it is always requested by
+// value.
+template <typename Requested>
+concept IsSetSpan = traits::is_set_span<Requested>;
+
+// ----------------------------------------------------------------------------
+// Storage
+// ----------------------------------------------------------------------------
+
+namespace multibinding {
+
+//! Element type pointed to by a set span, e.g. Handler for span<Handler*>.
+template <typename SetSpan>
+using SpanElement = std::remove_pointer_t<typename SetSpan::value_type>;
+
+//! Key type of the bindings contributing to a set span.
+template <typename SetSpan>
+using SpanKey = SetOf<std::remove_cv_t<SpanElement<SetSpan>>>;
+
+//! Provides the contiguous array of element pointers backing a set span.
+//
+// The array is cached by the container like any other singleton. The cache is
+// keyed on this provider type, so each container holds one array per element
+// type and size.
+template <typename Element, std::size_t size>
+struct ArrayProvider {
+  using Provided = std::array<Element*, size>;
+
+  template <typename Requested, typename Container>
+  auto create(Container& container) -> Provided {
+    return std::apply(
+        [](auto&... elements) { return Provided{&elements...}; },
+        container.template resolve_set<std::remove_cv_t<Element>>());
+  }
+};
+
+}  // namespace multibinding
+
+}  // namespace dink
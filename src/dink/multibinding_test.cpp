@@ -0,0 +1,75 @@
+// \file
+// Copyright (c) 2025 Frank Secilia
+// SPDX-License-Identifier: MIT
+
+#include "multibinding.hpp"
+#include <dink/test.hpp>
+
+namespace dink {
+namespace {
+
+struct Element {};
+
+// ----------------------------------------------------------------------------
+// IsSetSpan
+// ----------------------------------------------------------------------------
+
+static_assert(IsSetSpan<std::span<Element* const>>);
+static_assert(IsSetSpan<std::span<Element* const, 3>>);
+static_assert(IsSetSpan<std::span<const Element* const>>);
+static_assert(!IsSetSpan<std::span<Element*>>);
+static_assert(!IsSetSpan<std::span<Element>>);
+static_assert(!IsSetSpan<std::span<Element* const>&>);
+static_assert(!IsSetSpan<Element*>);
+
+static_assert(std::same_as<SetOf<Element>,
+                           multibinding::SpanKey<std::span<Element* const>>>);
+static_assert(
+    std::same_as<SetOf<Element>,
+                 multibinding::SpanKey<std::span<const Element* const, 2>>>);
+
+// ----------------------------------------------------------------------------
+// ArrayProvider
+// ----------------------------------------------------------------------------
+
+struct MultibindingArrayProviderTest : Test {
+  struct Derived1 : Element {};
+  struct Derived2 : Element {};
+
+  // Resolves a fixed set.
+  struct Container {
+    Derived1 derived1{};
+    Derived2 derived2{};
+
+    template <typename Requested>
+    auto resolve_set() -> std::tuple<Derived1&, Derived2&> {
+      static_assert(std::same_as<Element, Requested>);
+      return {derived1, derived2};
+    }
+  };
+  Container container;
+};
+
+TEST_F(MultibindingArrayProviderTest, creates_pointers_in_set_order) {
+  using Sut = multibinding::ArrayProvider<Element, 2>;
+  auto sut = Sut{};
+
+  const auto result = sut.create<Sut::Provided>(container);
+
+  ASSERT_EQ(&container.derived1, result[0]);
+  ASSERT_EQ(&container.derived2, result[1]);
+}
+
+TEST_F(MultibindingArrayProviderTest, creates_pointers_to_const) {
+  using Sut = multibinding::ArrayProvider<const Element, 2>;
+  auto sut = Sut{};
+
+  const auto result = sut.create<Sut::Provided>(container);
+
+  static_assert(std::same_as<const std::array<const Element*, 2>,
+                             decltype(result)>);
+  ASSERT_EQ(&container.derived2, result[1]);
+}
+
+}  // namespace
+}  // namespace dink
@@ -0,0 +1,159 @@
+// \file
+// Copyright (c) 2025 Frank Secilia
+// SPDX-License-Identifier: MIT
+//
+// \brief Compile-time qualifiers distinguishing bindings of the same type.
+//
+// Qualified bindings are bound with .named<Qualifier>(), or equivalently by
+// binding NamedKey<Qualifier, Type> directly:
+//
+//   struct Primary {};
+//   struct Replica {};
+//   auto container = Container{
+//       bind<DbPool>().named<Primary>().via(make_primary).in<Singleton>(),
+//       bind<DbPool>().named<Replica>().via(make_replica).in<Singleton>(),
+//   };
+//
+// Consumers inject Named<Qualifier, Requested>, where Requested is any form
+// the container can resolve, e.g. Named<Primary, DbPool&>. The qualifier is
+// part of the binding's key type, so lookup is the same compile-time search
+// used for any other binding.
+
+#pragma once
+
+#include <dink/lib.hpp>
+#include <dink/canonical.hpp>
+#include <dink/meta.hpp>
+#include <memory>
+#include <type_traits>
+#include <utility>
+
+namespace dink {
+
+// ----------------------------------------------------------------------------
+// NamedKey
+// ----------------------------------------------------------------------------
+
+//! Binding key for Type qualified by Qualifier.
+//
+// NamedKey is only a key; it is never constructed. It is kept separate from
+// Named so abstract types can be keys.
+template <typename Qualifier, typename Type>
+struct NamedKey {
+  NamedKey() = delete;
+};
+
+// ----------------------------------------------------------------------------
+// Named
+// ----------------------------------------------------------------------------
+
+//! Requested instance, qualified by Qualifier.
+//
+// Named holds the instance resolved from the binding keyed on
+// NamedKey<Qualifier, Canonical<Requested>>, in the form given by Requested.
+//
+// A qualified request must be bound somewhere in the hierarchy; there is no
+// fallback binding for qualified types.
+template <typename Qualifier, typename Requested>
+class Named {
+ public:
+  using QualifierType = Qualifier;
+  using RequestedType = Requested;
+
+  //! Type produced by resolving Requested.
+  using Resolved = meta::RemoveRvalueRef<Requested>;
+
+  //! Returns the resolved instance.
+  constexpr auto get() noexcept -> Resolved& { return resolved_; }
+  constexpr auto get() const noexcept -> const Resolved& { return resolved_; }
+
+  //! Dereferences the resolved instance, or the pointer it holds.
+  constexpr auto operator*() const -> decltype(auto) {
+    if constexpr (kResolvesPointerLike) {
+      return *resolved_;
+    } else {
+      return get();
+    }
+  }
+
+  //! Accesses members of the resolved instance.
+  constexpr auto operator->() const -> auto {
+    if constexpr (kResolvesPointerLike) {
+      return std::to_address(resolved_);
+    } else {
+      return std::addressof(get());
+    }
+  }
+
+  explicit constexpr Named(Resolved resolved) noexcept(
+      std::is_nothrow_move_constructible_v<Resolved>)
+      : resolved_{std::forward<Resolved>(resolved)} {}
+
+ private:
+  static constexpr auto kResolvesPointerLike =
+      std::is_pointer_v<Resolved> || meta::IsSharedPtr<Resolved> ||
+      meta::IsUniquePtr<Resolved> || meta::IsInlinePoly<Resolved>;
+
+  Resolved resolved_;
+};
+
+// ----------------------------------------------------------------------------
+// Concepts
+// ----------------------------------------------------------------------------
+
+namespace traits {
+
+template <typename Requested>
+struct IsNamed : std::false_type {};
+
+template <typename Qualifier, typename Requested>
+struct IsNamed<Named<Qualifier, Requested>> : std::true_type {};
+
+template <typename Requested>
+inline constexpr auto is_named = IsNamed<Requested>::value;
+
+}  // namespace traits
+
+//! Matches qualified requests.
+template <typename Requested>
+concept IsNamed = traits::is_named<std::remove_cvref_t<Requested>>;
+
+// ----------------------------------------------------------------------------
+// Unqualified
+// ----------------------------------------------------------------------------
+
+namespace named::detail {
+
+template <typename Type>
+struct Unqualified {
+  using Result = Type;
+};
+
+template <typename Qualifier, typename Type>
+struct Unqualified<NamedKey<Qualifier, Type>> {
+  using Result = Type;
+};
+
+}  // namespace named::detail
+
+//! Removes a qualifier from a binding key, yielding the constructed type.
+template <typename Type>
+using Unqualified = typename named::detail::Unqualified<Type>::Result;
+
+// ----------------------------------------------------------------------------
+// Canonical
+// ----------------------------------------------------------------------------
+
+namespace canonical::detail {
+
+//! Canonicalizes the requested type, but keeps the qualifier.
+//
+// The result is the binding key, NamedKey<Qualifier, Canonical<Requested>>.
+template <typename Qualifier, typename Requested>
+struct Canonical<Named<Qualifier, Requested>> {
+  using Type = NamedKey<Qualifier, dink::Canonical<Requested>>;
+};
+
+}  // namespace canonical::detail
+
+}  // namespace dink
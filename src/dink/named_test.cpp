@@ -0,0 +1,65 @@
+// \file
+// Copyright (c) 2025 Frank Secilia
+// SPDX-License-Identifier: MIT
+
+#include "named.hpp"
+#include <dink/test.hpp>
+
+namespace dink {
+namespace {
+
+struct NamedTest : Test {
+  static constexpr auto kValue = int_t{6271};  // Arbitrary.
+
+  struct Qualifier {};
+  struct Resolved {
+    int_t value = kValue;
+  };
+};
+
+// Canonical keeps the qualifier, but canonicalizes what it qualifies.
+static_assert(
+    std::same_as<Canonical<Named<NamedTest::Qualifier, NamedTest::Resolved&>>,
+                 NamedKey<NamedTest::Qualifier, NamedTest::Resolved>>);
+static_assert(std::same_as<
+              Canonical<const Named<NamedTest::Qualifier,
+                                    std::shared_ptr<NamedTest::Resolved>>&>,
+              NamedKey<NamedTest::Qualifier, NamedTest::Resolved>>);
+static_assert(std::same_as<Canonical<Named<NamedTest::Qualifier, int_t>>,
+                           NamedKey<NamedTest::Qualifier, int_t>>);
+
+static_assert(IsNamed<Named<NamedTest::Qualifier, int_t>>);
+static_assert(IsNamed<const Named<NamedTest::Qualifier, int_t>&>);
+static_assert(!IsNamed<int_t>);
+
+static_assert(
+    std::same_as<Unqualified<NamedKey<NamedTest::Qualifier, int_t>>, int_t>);
+static_assert(std::same_as<Unqualified<int_t>, int_t>);
+
+TEST_F(NamedTest, holds_value) {
+  const auto sut = Named<Qualifier, Resolved>{Resolved{}};
+
+  ASSERT_EQ(kValue, sut.get().value);
+  ASSERT_EQ(kValue, sut->value);
+  ASSERT_EQ(&sut.get(), &*sut);
+}
+
+TEST_F(NamedTest, holds_reference) {
+  auto resolved = Resolved{};
+
+  const auto sut = Named<Qualifier, Resolved&>{resolved};
+
+  ASSERT_EQ(&resolved, &sut.get());
+  ASSERT_EQ(&resolved, &*sut);
+}
+
+TEST_F(NamedTest, dereferences_through_pointer_like) {
+  auto sut = Named<Qualifier, std::unique_ptr<Resolved>>{
+      std::make_unique<Resolved>()};
+
+  ASSERT_EQ(kValue, sut->value);
+  ASSERT_EQ(sut.get().get(), &*sut);
+}
+
+}  // namespace
+}  // namespace dink
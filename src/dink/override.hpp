@@ -0,0 +1,141 @@
+// \file
+// Copyright (c) 2025 Frank Secilia
+// SPDX-License-Identifier: MIT
+//
+// \brief Call-site overrides applied to a single resolution.
+//
+// container.resolve_with<Requested>(override<X>(x), ...) resolves Requested as
+// resolve<Requested>() would, except that anywhere in the subgraph X is
+// requested, x is used instead. No child container is created and nothing is
+// allocated; the overrides live on the stack for the duration of the call.
+
+#pragma once
+
+#include <dink/lib.hpp>
+#include <dink/adapter.hpp>
+#include <dink/binding.hpp>
+#include <dink/binding_dsl.hpp>
+#include <dink/canonical.hpp>
+#include <dink/config.hpp>
+#include <dink/cycle.hpp>
+#include <dink/meta.hpp>
+#include <dink/provider.hpp>
+#include <dink/scope.hpp>
+#include <dink/type_list.hpp>
+#include <type_traits>
+#include <utility>
+
+namespace dink {
+
+// ----------------------------------------------------------------------------
+// override
+// ----------------------------------------------------------------------------
+
+//! Overrides requests for From with instance for one resolution.
+//
+// This is a binding to an external instance, exactly what
+// bind<From>().to(instance) produces, so requests for From are supported in
+// the same forms: values and unique_ptrs are copies; references and pointers
+// alias instance.
+template <typename From, typename Instance>
+constexpr auto override(Instance& instance) noexcept
+    -> Binding<From, scope::Instance, provider::External<Instance>> {
+  return bind<From>().to(instance);
+}
+
+// ----------------------------------------------------------------------------
+// Concepts
+// ----------------------------------------------------------------------------
+
+namespace traits {
+
+template <typename Override>
+struct IsOverride : std::false_type {};
+
+template <typename From, typename Instance>
+struct IsOverride<Binding<From, scope::Instance, provider::External<Instance>>>
+    : std::true_type {};
+
+template <typename Override>
+inline constexpr auto is_override = IsOverride<Override>::value;
+
+}  // namespace traits
+
+//! Matches the bindings produced by override().
+template <typename Override>
+concept IsOverride = traits::is_override<std::remove_cvref_t<Override>>;
+
+// ----------------------------------------------------------------------------
+// OverridingContainer
+// ----------------------------------------------------------------------------
+
+//! Container adapter that applies overrides to one resolution's subgraph.
+//
+// This is created on the stack by Container::resolve_with(). It dispatches
+// with the container's own dispatcher, config, and parent, but passes itself
+// as the container, so every request made while building the subgraph comes
+// back through it and is checked against the overrides first. Types it
+// constructs enter a CycleCheckingContainer, which dispatches through it, too.
+//
+// Only the uncached part of the subgraph is affected:
+// - Cached instances are created through the underlying container. They
+//   outlive this call, so they must not capture its overrides.
+// - Handles bind to the underlying container for the same reason.
+// - Requests delegated to a parent container resolve there, without
+//   overrides.
+template <typename Container, typename Dispatcher, typename Config,
+          typename ParentPtr, typename... Overrides>
+class OverridingContainer
+    : public DispatchingContainer<
+          OverridingContainer<Container, Dispatcher, Config, ParentPtr,
+                              Overrides...>,
+          Container, Dispatcher, Config, ParentPtr> {
+ public:
+  static_assert((IsOverride<Overrides> && ...),
+                "resolve_with() takes only the bindings made by override()");
+
+  //! true if requests through this may refer to the current graph's instances.
+  //
+  // Only the request this was created for may not, but unless cycle detection
+  // tracks them, types constructed here resolve their dependencies through
+  // this adapter, too, so it can't tell them apart. \sa scope::PerGraph
+  static constexpr auto resolves_within_graph = !dink_detect_cycles;
+
+  //! Resolves Requested from its override, if any, or from its binding.
+  template <typename Requested, typename Requesting>
+  auto dispatch(Requesting& requesting) -> meta::RemoveRvalueRef<Requested> {
+    auto binding =
+        overrides_.template find_binding<Canonical<Requested>>();
+    constexpr bool found_override =
+        !std::is_same_v<decltype(binding), std::nullptr_t>;
+
+    if constexpr (found_override) {
+      return binding->scope.template resolve<Requested>(requesting,
+                                                        binding->provider);
+    } else {
+      return OverridingContainer::DispatchingContainer::template dispatch<
+          Requested>(requesting);
+    }
+  }
+
+  //! Begins constructing Constructed, tracking it to detect cycles.
+  //
+  // \sa dink_detect_cycles
+  template <typename Constructed>
+  auto enter() noexcept -> auto {
+    return CycleCheckingContainer<OverridingContainer, TypeList<Constructed>>{
+        *this};
+  }
+
+  OverridingContainer(Container& container, Dispatcher& dispatcher,
+                      Config& config, ParentPtr parent,
+                      Overrides... overrides) noexcept
+      : OverridingContainer::DispatchingContainer{container, dispatcher, config,
+                                                  parent},
+        overrides_{std::move(overrides)...} {}
+
+ private:
+  dink::Config<Overrides...> overrides_;
+};
+
+}  // namespace dink
@@ -0,0 +1,128 @@
+// \file
+// Copyright (c) 2025 Frank Secilia
+// SPDX-License-Identifier: MIT
+
+#include "override.hpp"
+#include <dink/test.hpp>
+
+namespace dink {
+namespace {
+
+struct OverrideTest : Test {
+  static constexpr auto kDispatchedValue = int_t{1811};  // Arbitrary.
+  static constexpr auto kOverrideValue = int_t{4026};    // Arbitrary.
+
+  struct Dependency {
+    int_t value;
+  };
+
+  struct Dependent {
+    Dependency dependency;
+    Dependency* reference;
+  };
+
+  struct Handle {
+    int_t* source;
+  };
+
+  // Builds Dependent by requesting its dependencies back through container.
+  struct Dispatcher {
+    int_t num_dispatches = 0;
+
+    template <typename Requested, typename Container, typename Config,
+              typename ParentPtr>
+    auto resolve(Container& container, Config&, ParentPtr)
+        -> meta::RemoveRvalueRef<Requested> {
+      ++num_dispatches;
+      if constexpr (std::same_as<Requested, Dependent>) {
+        return Dependent{container.template resolve<Dependency>(),
+                         container.template resolve<Dependency*>()};
+      } else {
+        return Dependency{kDispatchedValue};
+      }
+    }
+  };
+  Dispatcher dispatcher;
+
+  // Underlying container; only handles and cached entries reach it.
+  struct Container {
+    int_t source{};
+    int_t num_gets = 0;
+
+    template <typename Requested>
+    auto resolve() -> Handle {
+      return Handle{&source};
+    }
+
+    template <typename Provider>
+    auto get_or_create(Provider&) -> Provider::Provided& {
+      ++num_gets;
+      static auto instance = typename Provider::Provided{kDispatchedValue};
+      return instance;
+    }
+  };
+  Container container;
+
+  struct Config {};
+  Config config;
+
+  struct CachedProvider {
+    using Provided = Dependency;
+  };
+
+  Dependency overridden{kOverrideValue};
+};
+
+}  // namespace
+
+namespace traits {
+template <>
+struct IsHandle<OverrideTest::Handle> : std::true_type {};
+}  // namespace traits
+
+namespace {
+
+static_assert(IsOverride<decltype(override<int_t>(std::declval<int_t&>()))>);
+static_assert(!IsOverride<decltype(Binding{bind<int_t>()})>);
+
+TEST_F(OverrideTest, dispatches_without_overrides) {
+  auto sut = OverridingContainer{container, dispatcher, config, nullptr};
+
+  const auto result = sut.resolve<Dependency>();
+
+  ASSERT_EQ(kDispatchedValue, result.value);
+  ASSERT_EQ(1, dispatcher.num_dispatches);
+}
+
+TEST_F(OverrideTest, overrides_requests_made_while_dispatching) {
+  auto sut = OverridingContainer{container, dispatcher, config, nullptr,
+                                 override<Dependency>(overridden)};
+
+  const auto result = sut.resolve<Dependent>();
+
+  ASSERT_EQ(kOverrideValue, result.dependency.value);
+  ASSERT_EQ(&overridden, result.reference);
+  ASSERT_EQ(1, dispatcher.num_dispatches);
+}
+
+TEST_F(OverrideTest, forwards_handles_to_underlying_container) {
+  auto sut = OverridingContainer{container, dispatcher, config, nullptr,
+                                 override<Dependency>(overridden)};
+
+  ASSERT_EQ(&container.source, sut.resolve<Handle>().source);
+  ASSERT_EQ(0, dispatcher.num_dispatches);
+}
+
+TEST_F(OverrideTest, forwards_cache_to_underlying_container) {
+  auto sut = OverridingContainer{container, dispatcher, config, nullptr,
+                                 override<Dependency>(overridden)};
+  auto provider = CachedProvider{};
+
+  const auto& result = sut.get_or_create(provider);
+
+  ASSERT_EQ(kDispatchedValue, result.value);
+  ASSERT_EQ(1, container.num_gets);
+}
+
+}  // namespace
+}  // namespace dink
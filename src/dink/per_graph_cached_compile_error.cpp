@@ -0,0 +1,31 @@
+// \file
+// Copyright (c) 2025 Frank Secilia
+// SPDX-License-Identifier: MIT
+//
+// Must fail to compile: a reference to a per-graph instance would dangle.
+//
+// Built on demand by the dink_per_graph_cached_compile_error test. The
+// singleton outlives the graph it is first constructed in, along with the
+// reference it keeps.
+
+#include <dink/binding_dsl.hpp>
+#include <dink/container.hpp>
+
+namespace dink {
+namespace {
+
+struct Shared {};
+
+struct Dependent {
+  Shared& shared;
+  explicit Dependent(Shared& shared) noexcept : shared{shared} {}
+};
+
+[[maybe_unused]] auto resolve_dependent() -> void {
+  auto container = Container{bind<Shared>().in<scope::PerGraph>(),
+                             bind<Dependent>().in<scope::Singleton>()};
+  container.resolve<Dependent&>();
+}
+
+}  // namespace
+}  // namespace dink
@@ -0,0 +1,25 @@
+// \file
+// Copyright (c) 2025 Frank Secilia
+// SPDX-License-Identifier: MIT
+//
+// Must fail to compile: a reference to a per-graph instance would dangle.
+//
+// Built on demand by the dink_per_graph_compile_error test. The outermost
+// resolution's graph ends when it returns, before its caller could use the
+// reference.
+
+#include <dink/binding_dsl.hpp>
+#include <dink/container.hpp>
+
+namespace dink {
+namespace {
+
+struct Shared {};
+
+[[maybe_unused]] auto resolve_reference() -> void {
+  auto container = Container{bind<Shared>().in<scope::PerGraph>()};
+  container.resolve<Shared&>();
+}
+
+}  // namespace
+}  // namespace dink
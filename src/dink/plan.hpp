@@ -0,0 +1,275 @@
+// \file
+// Copyright (c) 2025 Frank Secilia
+// SPDX-License-Identifier: MIT
+//
+// \brief Flattened, topologically ordered construction of a root type.
+//
+// Resolving a type recursively resolves its dependencies from within its own
+// constructor call, so each level of a deep graph nests the whole resolution
+// chain of the next inside it, both when the compiler instantiates it and when
+// it runs. A long enough chain exceeds the compiler's template instantiation
+// depth.
+//
+// A plan instead lists every dependency of a root type once, dependencies
+// before their dependents, and resolve_planned() resolves them in that order:
+//
+//   auto& app = resolve_planned<App&>(container);
+//
+// Each node is instantiated from the plan rather than from its dependent, so
+// instantiation depth no longer grows with the graph. Nodes requested as
+// references or pointers are cached by the container, so they are resolved in
+// order before the root, and every cached dependency already exists when its
+// dependent is constructed. Cycle detection instantiates each cached node's
+// construction from its dependent again, only to check it, so instantiation
+// depth is only flattened with dink_detect_cycles disabled.
+//
+// Run time is only partly flattened. Nodes requested by value are named by the
+// plan, which instantiates them, but each value request creates a new
+// instance, so they are still constructed by their dependents, recursively,
+// through Resolver and Container::resolve(). Flattening them would take one
+// instance per path to the node rather than one per node. A plan only makes
+// run time a linear sequence of constructions for graphs whose edges are
+// references or pointers.
+//
+// Dependencies are only known for types that declare their injection, with
+// dink_inject or InjectTraits; other types are leaves of the plan and resolve
+// their own dependencies recursively, at instantiation and at run time alike.
+// The plan assumes each declaring type is constructed as declared, so a type
+// bound to a factory that ignores its declaration still has its declared
+// dependencies resolved.
+
+#pragma once
+
+#include <dink/lib.hpp>
+#include <dink/canonical.hpp>
+#include <dink/cycle.hpp>
+#include <dink/dispatcher.hpp>
+#include <dink/inject.hpp>
+#include <dink/meta.hpp>
+#include <dink/type_list.hpp>
+#include <cstddef>
+#include <type_traits>
+#include <utility>
+
+namespace dink {
+namespace plan::detail {
+
+//! Reduces a request to the node it is resolved through.
+//
+// Lvalue references and pointers to the same instance share one node, the
+// same shared reference the dispatcher resolves them through.
+template <typename Requested>
+struct Node {
+  using type = meta::RemoveRvalueRef<Requested>;
+};
+
+template <dispatcher::detail::IsReshaped Requested>
+struct Node<Requested> {
+  using type = typename dispatcher::detail::SharedReference<Requested>::type;
+};
+
+// ----------------------------------------------------------------------------
+// Topological Sort
+//
+// The graph is sorted by an iterative depth-first search, so the nesting depth
+// of the sort doesn't grow with the depth of the graph. Each step of the search
+// maps one State to the next, and batches of steps are applied by a fold
+// expression, whose steps are instantiated side by side rather than nested.
+// ----------------------------------------------------------------------------
+
+//! true if Element is one of Elements, which must be distinct.
+//
+// Membership is tested by base class lookup rather than a fold over
+// std::is_same, which would instantiate a trait per element on every step.
+template <typename Element>
+struct Member {};
+
+template <typename... Elements>
+struct Members : Member<Elements>... {};
+
+template <typename Element, typename... Elements>
+inline constexpr auto contains =
+    std::is_base_of_v<Member<Element>, Members<Elements...>>;
+
+template <typename Element, typename List>
+inline constexpr auto list_contains = false;
+
+template <typename Element, typename... Elements>
+inline constexpr auto list_contains<Element, TypeList<Elements...>> =
+    contains<Element, Elements...>;
+
+//! Node being visited, with the requests it still has to visit.
+template <typename Node, typename Pending>
+struct Frame {
+  using Visited = Node;
+};
+
+//! Search state: nodes ordered so far, and a stack of Frames, top first.
+template <typename Order, typename Stack>
+struct State {};
+
+//! Initial state for Root's plan.
+template <typename Root>
+using Start = State<TypeList<>,
+                    TypeList<Frame<Root, InjectDependencies<Canonical<Root>>>>>;
+
+//! Prepends a frame's node to a path.
+template <typename... Path, typename Visited, typename Pending>
+auto operator+(TypeList<Path...>, Frame<Visited, Pending>)
+    -> TypeList<Visited, Path...>;
+
+//! Nodes on a stack of Frames, outermost first.
+template <typename... Frames>
+using StackPath = decltype((TypeList<>{} + ... + Frames{}));
+
+//! Reports a cycle from a stack of Frames.
+template <bool cyclic, typename Requested, typename... Frames>
+struct ReportCycle {};
+
+template <typename Requested, typename... Frames>
+struct ReportCycle<true, Requested, Frames...>
+    : DependencyCycle<Requested, StackPath<Frames...>> {};
+
+//! Visits Requested from the top of Frames.
+//
+// Already-ordered nodes are skipped. A node already on the stack is a cycle,
+// which is reported and skipped, so the search still ends.
+template <typename Order, typename Requested, typename... Frames>
+struct Descend
+    : ReportCycle<contains<Requested, typename Frames::Visited...>,
+                  Requested, Frames...> {
+  static constexpr auto cyclic =
+      contains<Requested, typename Frames::Visited...>;
+
+  using type = std::conditional_t<
+      cyclic || list_contains<Requested, Order>,
+      State<Order, TypeList<Frames...>>,
+      State<Order, TypeList<Frame<Requested,
+                                  InjectDependencies<Canonical<Requested>>>,
+                            Frames...>>>;
+};
+
+//! Advances a search by one step.
+template <typename State>
+struct Step;
+
+//! Finished search; unchanged.
+template <typename Order>
+struct Step<State<Order, TypeList<>>> {
+  using type = State<Order, TypeList<>>;
+};
+
+//! Finished node; appended to the order.
+template <typename Order, typename Visited, typename... Frames>
+struct Step<State<Order, TypeList<Frame<Visited, TypeList<>>, Frames...>>> {
+  using type =
+      State<typename Order::template Append<Visited>, TypeList<Frames...>>;
+};
+
+//! Unfinished node; visits its next request.
+template <typename Order, typename Visited, typename Requested,
+          typename... Pending, typename... Frames>
+struct Step<
+    State<Order,
+          TypeList<Frame<Visited, TypeList<Requested, Pending...>>, Frames...>>>
+    : Descend<Order, typename Node<Requested>::type,
+              Frame<Visited, TypeList<Pending...>>, Frames...> {};
+
+//! Wraps a State so a fold expression can step it.
+template <typename State>
+struct Stepper {};
+
+template <std::size_t index>
+struct StepTag {};
+
+template <typename State, std::size_t index>
+auto operator|(Stepper<State>, StepTag<index>)
+    -> Stepper<typename Step<State>::type>;
+
+//! Number of steps applied by each fold.
+inline constexpr std::size_t steps_per_batch = 64;
+
+template <typename State, std::size_t... indices>
+auto step_batch(std::index_sequence<indices...>)
+    -> decltype((Stepper<State>{} | ... | StepTag<indices>{}));
+
+template <typename Stepper>
+struct Unwrap;
+
+template <typename State>
+struct Unwrap<Stepper<State>> {
+  using type = State;
+};
+
+//! Steps a search in batches until it finishes.
+template <typename State>
+struct Run
+    : Run<typename Unwrap<decltype(step_batch<State>(
+          std::make_index_sequence<steps_per_batch>{}))>::type> {};
+
+template <typename Order>
+struct Run<State<Order, TypeList<>>> {
+  using type = Order;
+};
+
+//! Resolves a plan's nodes in order.
+template <typename Nodes>
+struct Executor;
+
+template <typename... Nodes>
+struct Executor<TypeList<Nodes...>> {
+  //! Prepares each node in order, then resolves Root.
+  //
+  // Cached nodes are resolved for their side effect of creating the cached
+  // instance. Value nodes are only instantiated here, by naming their
+  // resolution path.
+  template <typename Root, typename Container>
+  static auto execute(Container& container) noexcept(
+      is_nothrow_execute<Root, Container>()) -> meta::RemoveRvalueRef<Root> {
+    (prepare<Nodes>(container), ...);
+    return container.template resolve<Root>();
+  }
+
+  //! true if resolving Root cannot throw.
+  //
+  // Whether a resolution can throw depends on its whole subgraph. Asking about
+  // each node in order first means no single question recurses deeply.
+  template <typename Root, typename Container>
+  static constexpr auto is_nothrow_execute() noexcept -> bool {
+    return (noexcept(std::declval<Container&>().template resolve<Nodes>()) &&
+            ...) &&
+           noexcept(std::declval<Container&>().template resolve<Root>());
+  }
+
+ private:
+  template <typename Node, typename Container>
+  static auto prepare(Container& container) -> void {
+    if constexpr (std::is_lvalue_reference_v<Node>) {
+      container.template resolve<Node>();
+    } else {
+      [[maybe_unused]] constexpr auto resolve =
+          &Container::template resolve<Node>;
+    }
+  }
+};
+
+}  // namespace plan::detail
+
+//! Dependencies of Root resolved by resolve_planned(), in construction order.
+//
+// Each node is the form a dependency is resolved as. The last node is Root's.
+template <typename Root>
+using Plan = typename plan::detail::Run<
+    plan::detail::Start<typename plan::detail::Node<Root>::type>>::type;
+
+//! Resolves Root after resolving its plan in order.
+//
+// Returns the same instance container.resolve<Root>() would.
+template <typename Root, typename Container>
+auto resolve_planned(Container& container) noexcept(
+    plan::detail::Executor<Plan<Root>>::template is_nothrow_execute<
+        Root, Container>()) -> meta::RemoveRvalueRef<Root> {
+  return plan::detail::Executor<Plan<Root>>::template execute<Root>(container);
+}
+
+}  // namespace dink
@@ -0,0 +1,145 @@
+// \file
+// Copyright (c) 2025 Frank Secilia
+// SPDX-License-Identifier: MIT
+
+#include "plan.hpp"
+#include <dink/test.hpp>
+#include <dink/container.hpp>
+#include <concepts>
+#include <memory>
+#include <vector>
+
+namespace dink {
+namespace {
+
+// Long enough to exceed the default template instantiation depth when
+// resolved recursively.
+template <int_t depth>
+struct Chain {
+  using dink_inject = Chain(Chain<depth - 1>&);
+  explicit Chain(Chain<depth - 1>& next) : length{next.length + 1} {}
+  int_t length;
+};
+
+template <>
+struct Chain<0> {
+  using dink_inject = Chain();
+  int_t length = 0;
+};
+
+inline constexpr auto kChainDepth = int_t{200};
+
+struct PlanTest : Test {
+  // Records the order instances are constructed in.
+  static inline std::vector<int_t> constructed;
+
+  template <int_t id>
+  struct Recorded {
+    Recorded() { constructed.push_back(id); }
+  };
+
+  struct Leaf : Recorded<0> {
+    using dink_inject = Leaf();
+  };
+
+  struct Left : Recorded<1> {
+    using dink_inject = Left(Leaf&);
+    explicit Left(Leaf&) {}
+  };
+
+  struct Right : Recorded<2> {
+    using dink_inject = Right(const Leaf*);
+    explicit Right(const Leaf*) {}
+  };
+
+  struct Diamond : Recorded<3> {
+    using dink_inject = Diamond(Left&, std::shared_ptr<Right>);
+    Diamond(Left& left, std::shared_ptr<Right> right)
+        : left{&left}, right{std::move(right)} {}
+
+    Left* left;
+    std::shared_ptr<Right> right;
+  };
+
+  // Deduced ctors have no known dependencies.
+  struct Undeclared {
+    explicit Undeclared(Leaf&) {}
+  };
+
+  struct HasUndeclared {
+    using dink_inject = HasUndeclared(Undeclared, const Leaf&);
+    HasUndeclared(Undeclared, const Leaf&) {}
+  };
+
+  struct Fields {
+    Left* left;
+    std::shared_ptr<Right> right;
+    using dink_inject = InjectFields<&Fields::left, &Fields::right>;
+  };
+
+  PlanTest() { constructed.clear(); }
+};
+
+// ----------------------------------------------------------------------------
+// Plan
+// ----------------------------------------------------------------------------
+
+// Dependencies precede dependents, and shared references are listed once.
+static_assert(
+    std::same_as<TypeList<PlanTest::Leaf&, PlanTest::Left&,
+                          std::shared_ptr<PlanTest::Right>, PlanTest::Diamond>,
+                 Plan<PlanTest::Diamond>>);
+
+// Undeclared types are leaves.
+static_assert(std::same_as<TypeList<PlanTest::Undeclared, PlanTest::Leaf&,
+                                    PlanTest::HasUndeclared&>,
+                           Plan<const PlanTest::HasUndeclared*>>);
+
+// Injected fields are dependencies.
+static_assert(
+    std::same_as<TypeList<PlanTest::Leaf&, PlanTest::Left&,
+                          std::shared_ptr<PlanTest::Right>, PlanTest::Fields>,
+                 Plan<PlanTest::Fields>>);
+
+static_assert(std::same_as<TypeList<Chain<0>&, Chain<1>&, Chain<2>&>,
+                           Plan<Chain<2>&>>);
+
+// ----------------------------------------------------------------------------
+// resolve_planned
+// ----------------------------------------------------------------------------
+
+TEST_F(PlanTest, resolves_cached_dependencies_before_dependents) {
+  auto sut = dink_unique_container();
+  auto& result = resolve_planned<Diamond&>(sut);
+
+  ASSERT_EQ((std::vector<int_t>{0, 1, 2, 3}), constructed);
+  ASSERT_EQ(&sut.resolve<Left&>(), result.left);
+}
+
+TEST_F(PlanTest, returns_same_instance_as_resolve) {
+  auto sut = dink_unique_container();
+  auto& result = resolve_planned<Diamond&>(sut);
+
+  ASSERT_EQ(&sut.resolve<Diamond&>(), &result);
+}
+
+TEST_F(PlanTest, resolves_new_values) {
+  auto sut = dink_unique_container();
+  auto& left = sut.resolve<Left&>();
+  constructed.clear();
+
+  const auto result = resolve_planned<Fields>(sut);
+
+  ASSERT_EQ((std::vector<int_t>{2}), constructed);
+  ASSERT_EQ(&left, result.left);
+}
+
+TEST_F(PlanTest, resolves_chain_deeper_than_recursive_resolution_allows) {
+  auto sut = dink_unique_container();
+  auto& result = resolve_planned<Chain<kChainDepth>&>(sut);
+
+  ASSERT_EQ(kChainDepth, result.length);
+}
+
+}  // namespace
+}  // namespace dink
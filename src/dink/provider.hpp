@@ -20,7 +20,9 @@ class Ctor {
   using Provided = Constructed;
 
   template <typename Requested, typename Container>
-  constexpr auto create(Container& container) -> auto {
+  constexpr auto create(Container& container) noexcept(
+      noexcept(invoker_factory_.template create<Constructed, void>()
+                   .template create<Requested>(container))) -> auto {
     const auto invoker = invoker_factory_.template create<Constructed, void>();
     return invoker.template create<Requested>(container);
   }
@@ -42,7 +44,12 @@ class Factory {
   using Provided = Constructed;
 
   template <typename Requested, typename Container>
-  constexpr auto create(Container& container) -> auto {
+  constexpr auto create(Container& container) noexcept(
+      noexcept(invoker_factory_
+                   .template create<Constructed, ConstructedFactory>()
+                   .template create<Requested>(container,
+                                               constructed_factory_)))
+      -> auto {
     const auto invoker =
         invoker_factory_.template create<Constructed, ConstructedFactory>();
     return invoker.template create<Requested>(container, constructed_factory_);
@@ -67,7 +74,8 @@ class External {
   using Provided = Instance;
 
   template <typename Requested, typename Container>
-  constexpr auto create(Container& /*container*/) const -> Instance& {
+  constexpr auto create(Container& /*container*/) const noexcept
+      -> Instance& {
     // Always return reference to the external instance
     return *instance_;
   }
@@ -79,4 +87,28 @@ class External {
   Instance* instance_;
 };
 
+//! Forwards to another provider under a type distinct per Qualifier.
+//
+// Caches are keyed on provider type. Qualified bindings wrap their provider in
+// this when resolving, so each qualifier gets its own cache entry even when
+// the underlying providers are the same type.
+template <typename Qualifier, typename Provider>
+class Qualified {
+ public:
+  using Provided = typename Provider::Provided;
+
+  template <typename Requested, typename Container>
+  constexpr auto create(Container& container) noexcept(
+      noexcept(provider_->template create<Requested>(container)))
+      -> decltype(auto) {
+    return provider_->template create<Requested>(container);
+  }
+
+  explicit constexpr Qualified(Provider& provider) noexcept
+      : provider_{&provider} {}
+
+ private:
+  Provider* provider_;
+};
+
 }  // namespace dink::provider
@@ -0,0 +1,114 @@
+// \file
+// Copyright (c) 2025 Frank Secilia
+// SPDX-License-Identifier: MIT
+//
+// \brief Injectable handle that resolves on demand.
+//
+// Not to be confused with the providers in provider.hpp, which are the
+// binding component that creates instances. Provider here is what consumers
+// inject to request instances repeatedly, e.g. a fresh transient per message.
+
+#pragma once
+
+#include <dink/lib.hpp>
+#include <dink/canonical.hpp>
+#include <dink/fwd.hpp>
+#include <dink/handle.hpp>
+#include <dink/meta.hpp>
+#include <concepts>
+#include <memory>
+#include <type_traits>
+
+namespace dink {
+
+// ----------------------------------------------------------------------------
+// Provider
+// ----------------------------------------------------------------------------
+
+//! Resolves Requested from a container each time it is called.
+//
+// Provider is injectable from the container named by Container, or from any
+// container if that is AnyContainer, and provider_for() deduces it from a
+// container. It is trivially copyable, and each call resolves through the
+// container as if resolve<Requested>() were called directly, so it works with
+// every scope: transients produce new instances, and singletons produce the
+// cached instance.
+template <typename Requested, typename Container>
+class Provider {
+ public:
+  //! Type produced by resolving Requested.
+  using Resolved = meta::RemoveRvalueRef<Requested>;
+
+  //! Resolves Requested.
+  auto operator()() const -> Resolved {
+    return container_->template resolve<Requested>();
+  }
+
+  explicit constexpr Provider(Container& container) noexcept
+      : container_{std::addressof(container)} {}
+
+ private:
+  Container* container_;
+};
+
+//! Specialization for AnyContainer resolves from any container.
+template <typename Requested>
+class Provider<Requested, AnyContainer> {
+ public:
+  //! Type produced by resolving Requested.
+  using Resolved = meta::RemoveRvalueRef<Requested>;
+
+  //! Resolves Requested.
+  auto operator()() const -> Resolved { return resolve_(container_); }
+
+  template <typename Container>
+    requires(!std::same_as<std::remove_cvref_t<Container>, Provider>)
+  explicit constexpr Provider(Container& container) noexcept
+      : container_{std::addressof(container)},
+        resolve_{&resolve<Container>} {}
+
+ private:
+  using ResolveFunction = auto (*)(void* container) -> Resolved;
+
+  //! Resolves from the concrete container type.
+  template <typename Container>
+  static auto resolve(void* container) -> Resolved {
+    return static_cast<Container*>(container)->template resolve<Requested>();
+  }
+
+  void* container_;
+  ResolveFunction resolve_;
+};
+
+//! Creates a Provider for Requested bound to container's type.
+template <typename Requested, typename Container>
+constexpr auto provider_for(Container& container) noexcept
+    -> Provider<Requested, Container> {
+  return Provider<Requested, Container>{container};
+}
+
+// ----------------------------------------------------------------------------
+// Concepts
+// ----------------------------------------------------------------------------
+
+namespace traits {
+
+//! Provider is a handle; it is created from the requesting container.
+template <typename Requested, typename Container>
+struct IsHandle<Provider<Requested, Container>> : std::true_type {};
+
+}  // namespace traits
+
+// ----------------------------------------------------------------------------
+// Canonical
+// ----------------------------------------------------------------------------
+
+namespace canonical::detail {
+
+//! Removes Provider.
+template <typename Requested, typename Container>
+struct Canonical<Provider<Requested, Container>> : Canonical<Requested> {};
+
+}  // namespace canonical::detail
+
+}  // namespace dink
@@ -0,0 +1,127 @@
+// \file
+// Copyright (c) 2025 Frank Secilia
+// SPDX-License-Identifier: MIT
+
+#include "provider_handle.hpp"
+#include <dink/test.hpp>
+
+namespace dink {
+namespace {
+
+struct ProviderHandleTest : Test {
+  static constexpr auto kInitialValue = int_t{8251};  // Arbitrary.
+
+  struct Resolved {
+    int_t value = kInitialValue;
+  };
+
+  // Counts resolves and returns a cached instance or a new value.
+  struct Container {
+    int_t num_resolves = 0;
+    Resolved instance{};
+
+    template <typename Requested>
+    auto resolve() -> meta::RemoveRvalueRef<Requested> {
+      ++num_resolves;
+      if constexpr (std::is_lvalue_reference_v<Requested>) {
+        return instance;
+      } else {
+        return Resolved{num_resolves};
+      }
+    }
+  };
+  Container container;
+};
+
+static_assert(std::is_trivially_copyable_v<
+              Provider<ProviderHandleTest::Resolved,
+                       ProviderHandleTest::Container>>);
+static_assert(std::is_trivially_copyable_v<
+              Provider<ProviderHandleTest::Resolved, AnyContainer>>);
+static_assert(sizeof(Provider<ProviderHandleTest::Resolved,
+                              ProviderHandleTest::Container>) ==
+              sizeof(void*));
+
+// The typed form only binds to its own container; AnyContainer binds to any.
+static_assert(std::constructible_from<
+              Provider<int_t, ProviderHandleTest::Container>,
+              ProviderHandleTest::Container&>);
+static_assert(!std::constructible_from<
+              Provider<int_t, ProviderHandleTest::Container>,
+              ProviderHandleTest::Resolved&>);
+static_assert(std::constructible_from<Provider<int_t, AnyContainer>,
+                                      ProviderHandleTest::Container&>);
+
+static_assert(std::same_as<
+              Canonical<Provider<ProviderHandleTest::Resolved&, AnyContainer>>,
+              ProviderHandleTest::Resolved>);
+
+static_assert(IsHandle<Provider<int_t, AnyContainer>>);
+static_assert(IsHandle<Provider<int_t, ProviderHandleTest::Container>>);
+
+// ----------------------------------------------------------------------------
+// Typed Container
+// ----------------------------------------------------------------------------
+
+TEST_F(ProviderHandleTest, typed_does_not_resolve_until_called) {
+  [[maybe_unused]] const auto sut = Provider<Resolved, Container>{container};
+
+  ASSERT_EQ(0, container.num_resolves);
+}
+
+TEST_F(ProviderHandleTest, typed_resolves_per_call) {
+  const auto sut = Provider<Resolved, Container>{container};
+
+  ASSERT_EQ(1, sut().value);
+  ASSERT_EQ(2, sut().value);
+}
+
+TEST_F(ProviderHandleTest, typed_resolves_reference) {
+  const auto sut = Provider<Resolved&, Container>{container};
+
+  ASSERT_EQ(&container.instance, &sut());
+}
+
+TEST_F(ProviderHandleTest, provider_for_deduces_typed_container) {
+  const auto sut = provider_for<Resolved&>(container);
+
+  static_assert(std::same_as<const Provider<Resolved&, Container>,
+                             decltype(sut)>);
+  ASSERT_EQ(&container.instance, &sut());
+}
+
+// ----------------------------------------------------------------------------
+// AnyContainer
+// ----------------------------------------------------------------------------
+
+TEST_F(ProviderHandleTest, untyped_does_not_resolve_until_called) {
+  [[maybe_unused]] const auto sut = Provider<Resolved, AnyContainer>{container};
+
+  ASSERT_EQ(0, container.num_resolves);
+}
+
+TEST_F(ProviderHandleTest, untyped_resolves_per_call) {
+  const auto sut = Provider<Resolved, AnyContainer>{container};
+
+  ASSERT_EQ(1, sut().value);
+  ASSERT_EQ(2, sut().value);
+}
+
+TEST_F(ProviderHandleTest, untyped_resolves_reference) {
+  const auto sut = Provider<Resolved&, AnyContainer>{container};
+
+  ASSERT_EQ(&container.instance, &sut());
+}
+
+TEST_F(ProviderHandleTest, untyped_copies_resolve_from_same_container) {
+  const auto src = Provider<Resolved, AnyContainer>{container};
+  const auto sut = src;
+
+  src();
+  sut();
+
+  ASSERT_EQ(2, container.num_resolves);
+}
+
+}  // namespace
+}  // namespace dink
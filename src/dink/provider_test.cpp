@@ -385,5 +385,31 @@ TEST_F(ProviderInstanceMultipleContainersTest,
   EXPECT_EQ(initial_value, ref1.value);
 }
 
+// ----------------------------------------------------------------------------
+// Qualified
+// ----------------------------------------------------------------------------
+
+struct ProviderQualifiedTest : InstanceFixture, Test {
+  struct Qualifier {};
+  using Underlying = External<Constructed>;
+  using Sut = Qualified<Qualifier, Underlying>;
+
+  Constructed external_instance{initial_value};
+  Underlying underlying{external_instance};
+  Sut sut{underlying};
+  Container container;
+};
+
+TEST_F(ProviderQualifiedTest, ProvidedMatchesUnderlying) {
+  static_assert(std::same_as<Sut::Provided, Underlying::Provided>);
+  static_assert(!std::same_as<Sut, Qualified<int_t, Underlying>>);
+}
+
+TEST_F(ProviderQualifiedTest, ForwardsToUnderlying) {
+  auto& result = sut.create<Constructed&>(container);
+
+  EXPECT_EQ(&external_instance, &result);
+}
+
 }  // namespace
 }  // namespace dink::provider
@@ -10,6 +10,8 @@
 #include <dink/meta.hpp>
 #include <dink/scope.hpp>
 #include <dink/type_list.hpp>
+#include <cstddef>
+#include <tuple>
 #include <utility>
 
 namespace dink {
@@ -45,16 +47,18 @@ class Resolver {
   // This method is NOT const to break ties in overload resolution, even though
   // it normally should be.
   template <typename Deduced>
-  constexpr operator Deduced() {
-    return resolve<Deduced>();
+  constexpr operator Deduced() noexcept(
+      noexcept(std::declval<Container&>().template resolve<Deduced>())) {
+    return container_.template resolve<Deduced>();
   }
 
   //! Reference conversion operator.
   //
   // This conversion matches only lvalue refs.
   template <typename Deduced>
-  constexpr operator Deduced&() const {
-    return resolve<Deduced&>();
+  constexpr operator Deduced&() const noexcept(
+      noexcept(std::declval<Container&>().template resolve<Deduced&>())) {
+    return container_.template resolve<Deduced&>();
   }
 
   explicit constexpr Resolver(Container& container) noexcept
@@ -62,11 +66,6 @@ class Resolver {
 
  private:
   Container& container_;
-
-  template <typename Deduced>
-  constexpr auto resolve() const -> Deduced {
-    return container_.template resolve<Deduced>();
-  }
 };
 
 //! Wraps Resolver to exclude matching Constructed's copy or move ctors
@@ -79,7 +78,8 @@ class SingleArgResolver {
   //
   // /sa Resolver::operator Deduced().
   template <meta::DifferentUnqualifiedType<Constructed> Deduced>
-  constexpr operator Deduced() {
+  constexpr operator Deduced() noexcept(
+      noexcept(std::declval<Resolver&>().operator Deduced())) {
     return resolver_.operator Deduced();
   }
 
@@ -87,7 +87,8 @@ class SingleArgResolver {
   //
   // /sa Resolver::operator Deduced&() const.
   template <meta::DifferentUnqualifiedType<Constructed> Deduced>
-  constexpr operator Deduced&() const {
+  constexpr operator Deduced&() const noexcept(
+      noexcept(std::declval<const Resolver&>().operator Deduced&())) {
     return resolver_.operator Deduced&();
   }
 
@@ -118,10 +119,60 @@ struct ResolverSequence {
   }
 };
 
+//! Resolves exactly Param from a container.
+//
+// Unlike Resolver, this converts only to the declared parameter type, so it
+// selects one constructor among overloads of the same arity, and never matches
+// copy or move ctors. Rvalue reference parameters bind to a resolved value.
+template <typename Param, typename Container>
+class DeclaredResolver {
+ public:
+  constexpr operator meta::RemoveRvalueRef<Param>() const
+      noexcept(is_nothrow_resolve()) {
+    return container_.template resolve<meta::RemoveRvalueRef<Param>>();
+  }
+
+  explicit constexpr DeclaredResolver(Container& container) noexcept
+      : container_{container} {}
+
+ private:
+  Container& container_;
+
+  static constexpr auto is_nothrow_resolve() noexcept -> bool {
+    return noexcept(std::declval<Container&>()
+                        .template resolve<meta::RemoveRvalueRef<Param>>());
+  }
+};
+
+//! Sequence that consumes indices to produce DeclaredResolvers.
+//
+// \tparam Signature function type whose parameters are resolved by index
+template <typename Signature>
+struct DeclaredResolverSequence;
+
+template <typename Return, typename... Params>
+struct DeclaredResolverSequence<Return(Params...)> {
+  template <typename Constructed, std::size_t arity, std::size_t index,
+            typename Container>
+  constexpr auto create_element(Container& container) const noexcept -> auto {
+    using Param = std::tuple_element_t<index, std::tuple<Params...>>;
+    return DeclaredResolver<Param, Container>{container};
+  }
+};
+
 template <typename ResolverSequence =
-              ResolverSequence<Resolver, SingleArgResolver>>
+              ResolverSequence<Resolver, SingleArgResolver>,
+          template <typename> typename DeclaredResolverSequence =
+              DeclaredResolverSequence>
 struct ResolverSequenceFactory {
   constexpr auto create() const noexcept -> ResolverSequence { return {}; }
+
+  //! Creates the sequence resolving a declared signature's parameters.
+  template <typename Signature>
+  constexpr auto create_declared() const noexcept
+      -> DeclaredResolverSequence<Signature> {
+    return {};
+  }
 };
 
 }  // namespace dink
@@ -51,7 +51,12 @@ TEST_F(ResolverReturnsRealInstancesFromContainerTest, result) {
 
 // Tests that resolvers convert to the expected type for types we expect.
 struct ResolverDeducesTypeTest {
-  struct Container;
+  // Conversions are only named, never called, so resolve() is only declared.
+  // Naming one still asks the container whether it throws.
+  struct Container {
+    template <typename Requested>
+    auto resolve() -> meta::RemoveRvalueRef<Requested>;
+  };
 
   struct Deduced {};
 
@@ -298,5 +303,66 @@ TEST_F(ResolverSequenceRunTimeTest, Arity3PreservesContainer) {
   EXPECT_EQ(resolver0.container_ptr->id, unique_id);
 }
 
+// ----------------------------------------------------------------------------
+// DeclaredResolverSequence
+// ----------------------------------------------------------------------------
+
+struct DeclaredResolverSequenceTest : Test {
+  struct A {
+    int_t value;
+  };
+  struct B {
+    int_t value;
+  };
+
+  // Records requested types and returns instances with arbitrary values.
+  struct Container {
+    A a{3};
+    int_t num_value_requests = 0;
+    int_t num_ref_requests = 0;
+
+    template <typename Requested>
+    auto resolve() -> Requested {
+      if constexpr (std::is_lvalue_reference_v<Requested>) {
+        ++num_ref_requests;
+        return a;
+      } else {
+        ++num_value_requests;
+        return Requested{5};
+      }
+    }
+  };
+  Container container;
+
+  // Overloaded ctors of the same arity that probing can't tell apart.
+  struct Constructed {
+    int_t value;
+    Constructed(A& a, B b) : value{a.value + b.value} {}
+    Constructed(B b, A& a) : value{-(a.value + b.value)} {}
+  };
+
+  using Sut = DeclaredResolverSequence<Constructed(A&, B&&)>;
+  Sut sut;
+};
+
+TEST_F(DeclaredResolverSequenceTest, creates_declared_resolvers) {
+  using Actual0 = decltype(sut.template create_element<Constructed, 2, 0>(
+      container));
+  using Actual1 = decltype(sut.template create_element<Constructed, 2, 1>(
+      container));
+  static_assert(std::same_as<DeclaredResolver<A&, Container>, Actual0>);
+  static_assert(std::same_as<DeclaredResolver<B&&, Container>, Actual1>);
+}
+
+TEST_F(DeclaredResolverSequenceTest, selects_declared_ctor) {
+  const auto result =
+      Constructed{sut.template create_element<Constructed, 2, 0>(container),
+                  sut.template create_element<Constructed, 2, 1>(container)};
+
+  EXPECT_EQ(8, result.value);
+  EXPECT_EQ(1, container.num_ref_requests);
+  EXPECT_EQ(1, container.num_value_requests);
+}
+
 }  // namespace
 }  // namespace dink
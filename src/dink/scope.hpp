@@ -9,7 +9,18 @@
 #include <dink/lib.hpp>
 #include <dink/meta.hpp>
 #include <concepts>
+#include <cstddef>
+#include <memory>
+#include <new>
 #include <type_traits>
+#include <utility>
+
+//! Controls the bytes reserved on the stack for each graph's entries.
+//
+// Entries beyond this are allocated individually from the heap.
+#if !defined dink_per_graph_arena_size
+#define dink_per_graph_arena_size 256
+#endif
 
 namespace dink::scope {
 
@@ -17,16 +28,14 @@ namespace dink::scope {
 class Transient {
  public:
   static constexpr auto provides_references = false;
+  static constexpr auto provides_shared_ptrs = true;
 
   //! Resolves instance in requested form.
   template <typename Requested, typename Container, typename Provider>
   auto resolve(Container& container, Provider& provider) const
-      -> meta::RemoveRvalueRef<Requested> {
-    using Provided = typename Provider::Provided;
-
-    if constexpr (meta::IsSharedPtr<Requested> ||
-                  meta::IsUniquePtr<Requested> ||
-                  std::same_as<std::remove_cvref_t<Requested>, Provided>) {
+      noexcept(is_nothrow_resolve<Requested, Container, Provider>())
+          -> meta::RemoveRvalueRef<Requested> {
+    if constexpr (is_supported<Requested, Provider>) {
       // Value type or rvalue reference.
       return provider.template create<Requested>(container);
     } else {
@@ -34,17 +43,37 @@ class Transient {
                     "Transient scope: unsupported type conversion.");
     }
   }
+
+ private:
+  template <typename Requested, typename Provider>
+  static constexpr auto is_supported =
+      meta::IsSharedPtr<Requested> || meta::IsUniquePtr<Requested> ||
+      meta::IsInlinePoly<Requested> ||
+      std::same_as<std::remove_cvref_t<Requested>,
+                   typename Provider::Provided>;
+
+  template <typename Requested, typename Container, typename Provider>
+  static constexpr auto is_nothrow_resolve() noexcept -> bool {
+    if constexpr (is_supported<Requested, Provider>) {
+      return noexcept(std::declval<Provider&>().template create<Requested>(
+          std::declval<Container&>()));
+    } else {
+      return true;
+    }
+  }
 };
 
 //! Resolves one instance per provider.
 class Singleton {
  public:
   static constexpr auto provides_references = true;
+  static constexpr auto provides_shared_ptrs = false;
 
   //! Resolves instance in requested form.
   template <typename Requested, typename Container, typename Provider>
   auto resolve(Container& container, Provider& provider) const
-      -> meta::RemoveRvalueRef<Requested> {
+      noexcept(is_nothrow_resolve<Requested, Container, Provider>())
+          -> meta::RemoveRvalueRef<Requested> {
     using Provided = typename Provider::Provided;
 
     if constexpr (std::is_same_v<std::remove_cvref_t<Requested>, Provided> ||
@@ -61,6 +90,10 @@ class Singleton {
     } else if constexpr (meta::IsUniquePtr<Requested>) {
       // unique_ptr.
       return std::make_unique<Provided>(cached_instance(container, provider));
+    } else if constexpr (meta::IsInlinePoly<Requested>) {
+      // InlinePoly.
+      return meta::RemoveRvalueRef<Requested>{
+          std::in_place_type<Provided>, cached_instance(container, provider)};
     } else {
       static_assert(meta::kDependentFalse<Requested>,
                     "Singleton scope: unsupported type conversion.");
@@ -71,20 +104,248 @@ class Singleton {
   //! Gets or creates cached instance.
   template <typename Container, typename Provider>
   static auto cached_instance(Container& container, Provider& provider)
-      -> Provider::Provided& {
+      noexcept(noexcept(container.get_or_create(provider)))
+          -> Provider::Provided& {
     return container.get_or_create(provider);
   }
+
+  template <typename Requested, typename Container, typename Provider>
+  static constexpr auto is_nothrow_resolve() noexcept -> bool {
+    using Provided = typename Provider::Provided;
+    using Resolved = meta::RemoveRvalueRef<Requested>;
+
+    constexpr auto is_nothrow_cached = noexcept(
+        std::declval<Container&>().get_or_create(std::declval<Provider&>()));
+    if constexpr (std::is_pointer_v<Requested>) {
+      return is_nothrow_cached;
+    } else if constexpr (meta::IsUniquePtr<Requested>) {
+      return false;
+    } else if constexpr (meta::IsInlinePoly<Requested>) {
+      return is_nothrow_cached &&
+             std::is_nothrow_constructible_v<
+                 Resolved, std::in_place_type_t<Provided>, Provided&>;
+    } else {
+      return is_nothrow_cached &&
+             std::is_nothrow_convertible_v<Provided&, Resolved>;
+    }
+  }
+};
+
+namespace per_graph {
+
+//! Storage for the per-graph instances of one outermost resolution.
+//
+// A Graph is created on the stack by the outermost Container::resolve() that
+// may reach a PerGraph binding, and is the thread's current graph until it is
+// destroyed. Entries are bump-allocated from an inline arena, or from the heap
+// once it is full, and linked into a list, newest first. Lookups scan the
+// list, and entries are destroyed newest first when the graph ends.
+class Graph {
+ public:
+  //! Gets the thread's current graph, or nullptr outside of a resolution.
+  static auto current() noexcept -> Graph* { return current_; }
+
+  //! Gets the instance stored for Provider, creating it on first use.
+  //
+  // \param create returns the instance to store as a prvalue
+  template <typename Provider, typename Stored, typename Create>
+  auto get_or_create(Create&& create) -> Stored& {
+    for (auto entry = head_; entry; entry = entry->next) {
+      if (entry->key == &type_key<Provider, Stored>) {
+        return static_cast<Node<Stored>*>(entry)->stored;
+      }
+    }
+
+    return emplace<Provider, Stored>(create);
+  }
+
+  Graph() noexcept : previous_{current_} { current_ = this; }
+
+  ~Graph() {
+    while (head_) {
+      auto entry = head_;
+      head_ = entry->next;
+      entry->destroy(*entry);
+    }
+    current_ = previous_;
+  }
+
+  Graph(const Graph&) = delete;
+  auto operator=(const Graph&) -> Graph& = delete;
+
+ private:
+  struct Entry {
+    const void* key;
+    Entry* next;
+    void (*destroy)(Entry&) noexcept;
+  };
+
+  template <typename Stored>
+  struct Node : Entry {
+    Stored stored;
+  };
+
+  template <typename Provider, typename Stored>
+  static constexpr auto type_key = char{};
+
+  static inline thread_local Graph* current_ = nullptr;
+
+  alignas(std::max_align_t) std::byte arena_[dink_per_graph_arena_size];
+  std::size_t used_ = 0;
+  Entry* head_ = nullptr;
+  Graph* previous_;
+
+  //! Creates and links a node, outside of get_or_create's hot path.
+  //
+  // Space is taken before create() runs, so instances it creates for its own
+  // dependencies are allocated after it, and destroyed before it.
+  template <typename Provider, typename Stored, typename Create>
+  [[dink_cold]] auto emplace(Create& create) -> Stored& {
+    using Node = Node<Stored>;
+
+    const auto key = &type_key<Provider, Stored>;
+    auto node = static_cast<Node*>(nullptr);
+    if (auto address = allocate(sizeof(Node), alignof(Node))) {
+      node = ::new (address) Node{{key, nullptr, &destroy_in_arena<Node>},
+                                  create()};
+    } else {
+      node = new Node{{key, nullptr, &destroy_on_heap<Node>}, create()};
+    }
+
+    node->next = head_;
+    head_ = node;
+    return node->stored;
+  }
+
+  //! Bump-allocates from the arena, or returns nullptr if it is full.
+  auto allocate(std::size_t size, std::size_t alignment) noexcept -> void* {
+    void* address = arena_ + used_;
+    auto space = sizeof(arena_) - used_;
+    if (!std::align(alignment, size, address, space)) return nullptr;
+
+    used_ = static_cast<std::size_t>(static_cast<std::byte*>(address) -
+                                     arena_) +
+            size;
+    return address;
+  }
+
+  template <typename Node>
+  static auto destroy_in_arena(Entry& entry) noexcept -> void {
+    static_cast<Node&>(entry).~Node();
+  }
+
+  template <typename Node>
+  static auto destroy_on_heap(Entry& entry) noexcept -> void {
+    delete &static_cast<Node&>(entry);
+  }
+};
+
+}  // namespace per_graph
+
+//! Resolves one instance per provider per object graph.
+//
+// Every request made while building one object graph, from a single outermost
+// Container::resolve(), refers to the same instance. The graph stores it, and
+// destroys it when that call returns, so references and pointers to it are
+// only for the other uncached instances of the same graph. Requesting them
+// from that call itself, through a handle, which resolves later, or while
+// constructing a cached instance, which outlives the graph, fails to compile.
+// That is only checked with dink_detect_cycles, which tracks where requests
+// are made from. Values, unique_ptrs, shared_ptrs, and InlinePolys are copies
+// of it, so only they require it to be copyable. weak_ptrs would have nothing
+// to observe, so they are unsupported.
+//
+// Outside of a graph, such as when this scope is used directly, each request
+// for a copy creates a new instance, as Transient would.
+class PerGraph {
+ public:
+  static constexpr auto provides_references = true;
+  static constexpr auto provides_shared_ptrs = true;
+
+  //! Resolves instance in requested form.
+  template <typename Requested, typename Container, typename Provider>
+  auto resolve(Container& container, Provider& provider) const
+      -> meta::RemoveRvalueRef<Requested> {
+    using Provided = typename Provider::Provided;
+    static_assert(is_supported<Requested, Provided>,
+                  "PerGraph scope: unsupported type conversion.");
+    static_assert(is_owned<Requested> || is_within_graph<Container>,
+                  "PerGraph scope: references and pointers dangle once the "
+                  "graph ends. Request them only while constructing an "
+                  "uncached instance of the same graph, or request a copy.");
+
+    if constexpr (is_owned<Requested>) {
+      if (auto graph = per_graph::Graph::current()) {
+        auto& instance = graph_instance(*graph, container, provider);
+        if constexpr (meta::IsSharedPtr<Requested>) {
+          // shared_ptr.
+          return std::make_shared<Provided>(instance);
+        } else if constexpr (meta::IsUniquePtr<Requested>) {
+          // unique_ptr.
+          return std::make_unique<Provided>(instance);
+        } else if constexpr (meta::IsInlinePoly<Requested>) {
+          // InlinePoly.
+          return meta::RemoveRvalueRef<Requested>{std::in_place_type<Provided>,
+                                                  instance};
+        } else {
+          // Value type or rvalue reference.
+          return instance;
+        }
+      }
+
+      return provider.template create<Requested>(container);
+    } else {
+      auto& instance =
+          graph_instance(*per_graph::Graph::current(), container, provider);
+      if constexpr (std::is_pointer_v<Requested>) {
+        // Pointers.
+        return &instance;
+      } else {
+        // Lvalue references.
+        return instance;
+      }
+    }
+  }
+
+ private:
+  template <typename Requested>
+  static constexpr auto is_owned =
+      !std::is_lvalue_reference_v<Requested> && !std::is_pointer_v<Requested>;
+
+  template <typename Requested, typename Provided>
+  static constexpr auto is_supported =
+      meta::IsSharedPtr<Requested> || meta::IsUniquePtr<Requested> ||
+      meta::IsInlinePoly<Requested> ||
+      std::same_as<std::remove_cvref_t<std::remove_pointer_t<Requested>>,
+                   Provided>;
+
+  //! true if requests through Container may refer to the graph's instances.
+  template <typename Container>
+  static constexpr auto is_within_graph =
+      requires { requires Container::resolves_within_graph; };
+
+  //! Gets the graph's instance, creating it on first use.
+  template <typename Container, typename Provider>
+  static auto graph_instance(per_graph::Graph& graph, Container& container,
+                             Provider& provider)
+      -> Provider::Provided& {
+    using Provided = typename Provider::Provided;
+    return graph.template get_or_create<Provider, Provided>(
+        [&] { return provider.template create<Provided>(container); });
+  }
 };
 
 //! Resolves one externally-owned instance.
 class Instance {
  public:
   static constexpr auto provides_references = true;
+  static constexpr auto provides_shared_ptrs = false;
 
   //! Resolves instance in requested form.
   template <typename Requested, typename Container, typename Provider>
   constexpr auto resolve(Container& container, Provider& provider) const
-      -> meta::RemoveRvalueRef<Requested> {
+      noexcept(is_nothrow_resolve<Requested, Container, Provider>())
+          -> meta::RemoveRvalueRef<Requested> {
     using Provided = typename Provider::Provided;
 
     // Get reference to the external instance from provider
@@ -104,11 +365,38 @@ class Instance {
     } else if constexpr (meta::IsUniquePtr<Requested>) {
       // unique_ptr.
       return std::make_unique<Provided>(instance);
+    } else if constexpr (meta::IsInlinePoly<Requested>) {
+      // InlinePoly.
+      return meta::RemoveRvalueRef<Requested>{std::in_place_type<Provided>,
+                                              instance};
     } else {
       static_assert(meta::kDependentFalse<Requested>,
                     "Instance scope: unsupported type conversion.");
     }
   }
+
+ private:
+  template <typename Requested, typename Container, typename Provider>
+  static constexpr auto is_nothrow_resolve() noexcept -> bool {
+    using Provided = typename Provider::Provided;
+    using Resolved = meta::RemoveRvalueRef<Requested>;
+
+    constexpr auto is_nothrow_located =
+        noexcept(std::declval<Provider&>().template create<Provided&>(
+            std::declval<Container&>()));
+    if constexpr (std::is_pointer_v<Requested>) {
+      return is_nothrow_located;
+    } else if constexpr (meta::IsUniquePtr<Requested>) {
+      return false;
+    } else if constexpr (meta::IsInlinePoly<Requested>) {
+      return is_nothrow_located &&
+             std::is_nothrow_constructible_v<
+                 Resolved, std::in_place_type_t<Provided>, Provided&>;
+    } else {
+      return is_nothrow_located &&
+             std::is_nothrow_convertible_v<Provided&, Resolved>;
+    }
+  }
 };
 
 }  // namespace dink::scope
@@ -4,6 +4,8 @@
 
 #include "scope.hpp"
 #include <dink/test.hpp>
+#include <array>
+#include <vector>
 
 namespace dink::scope {
 namespace {
@@ -20,6 +22,9 @@ struct ScopeTest : Test {
   };
 
   struct Container {
+    // Stands in for a type under construction within a graph.
+    static constexpr auto resolves_within_graph = true;
+
     template <typename Provider>
     auto get_or_create(Provider& provider) -> Provider::Provided& {
       static auto result =
@@ -582,6 +587,212 @@ TEST_F(ScopeTestSingletonConstructionCounts, calls_provider_create_only_once) {
   EXPECT_EQ(1, num_provider_calls);
 }
 
+// ----------------------------------------------------------------------------
+// PerGraph
+// ----------------------------------------------------------------------------
+
+struct ScopeTestPerGraph : ScopeTest {
+  // Counts calls to create, and distinguishes providers by id.
+  template <int_t id>
+  struct CountingProvider : EchoProvider<Resolved> {
+    int_t& num_calls;
+    using Provided = Resolved;
+
+    template <typename Requested>
+    auto create(Container& container) noexcept
+        -> std::remove_reference_t<Requested> {
+      ++num_calls;
+      return EchoProvider::template create<Requested>(container);
+    }
+  };
+
+  using Sut = PerGraph;
+  Sut sut{};
+
+  // Records the order instances are destroyed in.
+  static inline std::vector<int_t> destroyed;
+
+  template <int_t id>
+  struct Recorded {
+    ~Recorded() { destroyed.push_back(id); }
+  };
+
+  int_t num_provider_calls = 0;
+  CountingProvider<0> provider{.num_calls = num_provider_calls};
+
+  ScopeTestPerGraph() { destroyed.clear(); }
+};
+
+// Resolution
+// ----------------------------------------------------------------------------
+
+TEST_F(ScopeTestPerGraph, resolves_value) {
+  auto graph = per_graph::Graph{};
+  const auto result = sut.resolve<Resolved>(container, provider);
+  ASSERT_EQ(&container, result.container);
+}
+
+TEST_F(ScopeTestPerGraph, resolves_shared_ptr) {
+  auto graph = per_graph::Graph{};
+  const auto result =
+      sut.resolve<std::shared_ptr<Resolved>>(container, provider);
+  ASSERT_EQ(&container, result->container);
+}
+
+TEST_F(ScopeTestPerGraph, resolves_unique_ptr) {
+  auto graph = per_graph::Graph{};
+  const auto result =
+      sut.resolve<std::unique_ptr<Resolved>>(container, provider);
+  ASSERT_EQ(&container, result->container);
+}
+
+TEST_F(ScopeTestPerGraph, resolves_reference) {
+  auto graph = per_graph::Graph{};
+  const auto& result = sut.resolve<const Resolved&>(container, provider);
+  ASSERT_EQ(&container, result.container);
+}
+
+// Uniqueness (Per Graph)
+// ----------------------------------------------------------------------------
+
+TEST_F(ScopeTestPerGraph, calls_provider_create_once_per_graph) {
+  auto graph = per_graph::Graph{};
+
+  sut.resolve<Resolved>(container, provider);
+  sut.resolve<const Resolved>(container, provider);
+  sut.resolve<Resolved&&>(container, provider);
+  sut.resolve<Resolved&>(container, provider);
+  sut.resolve<const Resolved*>(container, provider);
+  sut.resolve<std::unique_ptr<Resolved>>(container, provider);
+  sut.resolve<std::shared_ptr<Resolved>>(container, provider);
+  sut.resolve<std::shared_ptr<const Resolved>>(container, provider);
+
+  ASSERT_EQ(1, num_provider_calls);
+}
+
+TEST_F(ScopeTestPerGraph, every_form_refers_to_graph_instance) {
+  auto graph = per_graph::Graph{};
+
+  auto& reference = sut.resolve<Resolved&>(container, provider);
+  reference.value = kModifiedValue;
+
+  ASSERT_EQ(&reference, sut.resolve<Resolved*>(container, provider));
+  ASSERT_EQ(kModifiedValue, sut.resolve<Resolved>(container, provider).value);
+  ASSERT_EQ(kModifiedValue,
+            sut.resolve<std::unique_ptr<Resolved>>(container, provider)->value);
+  ASSERT_EQ(kModifiedValue,
+            sut.resolve<std::shared_ptr<Resolved>>(container, provider)->value);
+}
+
+TEST_F(ScopeTestPerGraph, value_resolves_are_independent_copies) {
+  auto graph = per_graph::Graph{};
+
+  auto result1 = sut.resolve<Resolved>(container, provider);
+  result1.value = kModifiedValue;
+  const auto result2 = sut.resolve<Resolved>(container, provider);
+
+  ASSERT_EQ(kModifiedValue, result1.value);
+  ASSERT_EQ(kInitialValue, result2.value);
+}
+
+TEST_F(ScopeTestPerGraph, shared_ptr_resolves_are_independent_copies) {
+  auto graph = per_graph::Graph{};
+
+  const auto result1 =
+      sut.resolve<std::shared_ptr<Resolved>>(container, provider);
+  result1->value = kModifiedValue;
+  const auto result2 =
+      sut.resolve<std::shared_ptr<Resolved>>(container, provider);
+
+  ASSERT_NE(result1, result2);
+  ASSERT_NE(&sut.resolve<Resolved&>(container, provider), result1.get());
+  ASSERT_EQ(kInitialValue, result2->value);
+  ASSERT_EQ(1, num_provider_calls);
+}
+
+TEST_F(ScopeTestPerGraph, resolves_different_shared_ptrs_across_graphs) {
+  auto result1 = std::shared_ptr<Resolved>{};
+  {
+    auto graph = per_graph::Graph{};
+    result1 = sut.resolve<std::shared_ptr<Resolved>>(container, provider);
+  }
+
+  auto graph = per_graph::Graph{};
+  const auto result2 =
+      sut.resolve<std::shared_ptr<Resolved>>(container, provider);
+
+  ASSERT_NE(result1, result2);
+  ASSERT_EQ(kInitialValue, result1->value);
+}
+
+TEST_F(ScopeTestPerGraph, resolves_different_references_across_graphs) {
+  auto graph1 = std::make_unique<per_graph::Graph>();
+  auto& result1 = sut.resolve<Resolved&>(container, provider);
+  result1.value = kModifiedValue;
+  graph1.reset();
+
+  auto graph2 = per_graph::Graph{};
+  const auto& result2 = sut.resolve<Resolved&>(container, provider);
+
+  ASSERT_EQ(2, num_provider_calls);
+  ASSERT_EQ(kInitialValue, result2.value);
+}
+
+TEST_F(ScopeTestPerGraph, resolves_per_request_outside_of_graph) {
+  sut.resolve<Resolved>(container, provider);
+  const auto result1 =
+      sut.resolve<std::shared_ptr<Resolved>>(container, provider);
+  const auto result2 =
+      sut.resolve<std::shared_ptr<Resolved>>(container, provider);
+
+  ASSERT_EQ(3, num_provider_calls);
+  ASSERT_NE(result1, result2);
+}
+
+// Graph
+// ----------------------------------------------------------------------------
+
+TEST_F(ScopeTestPerGraph, graph_is_current_until_destroyed) {
+  ASSERT_EQ(nullptr, per_graph::Graph::current());
+  {
+    auto outer = per_graph::Graph{};
+    ASSERT_EQ(&outer, per_graph::Graph::current());
+    {
+      auto inner = per_graph::Graph{};
+      ASSERT_EQ(&inner, per_graph::Graph::current());
+    }
+    ASSERT_EQ(&outer, per_graph::Graph::current());
+  }
+  ASSERT_EQ(nullptr, per_graph::Graph::current());
+}
+
+TEST_F(ScopeTestPerGraph, graph_destroys_instances_newest_first) {
+  {
+    auto graph = per_graph::Graph{};
+    graph.get_or_create<Recorded<0>, Recorded<0>>([] { return Recorded<0>{}; });
+    graph.get_or_create<Recorded<1>, Recorded<1>>([] { return Recorded<1>{}; });
+    ASSERT_TRUE(destroyed.empty());
+  }
+
+  ASSERT_EQ((std::vector<int_t>{1, 0}), destroyed);
+}
+
+TEST_F(ScopeTestPerGraph, graph_stores_instances_beyond_arena_on_heap) {
+  using Large = std::array<int_t, dink_per_graph_arena_size / sizeof(int_t)>;
+  auto graph = per_graph::Graph{};
+
+  auto& first = graph.get_or_create<CountingProvider<0>, Large>(
+      [] { return Large{1}; });
+  auto& second = graph.get_or_create<CountingProvider<1>, Large>(
+      [] { return Large{2}; });
+
+  ASSERT_NE(&first, &second);
+  ASSERT_EQ(1, first[0]);
+  ASSERT_EQ(2, second[0]);
+  ASSERT_EQ(&first, (&graph.get_or_create<CountingProvider<0>, Large>(
+                        [] { return Large{}; })));
+}
+
 // ----------------------------------------------------------------------------
 // Instance
 // ----------------------------------------------------------------------------
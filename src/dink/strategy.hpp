@@ -8,9 +8,12 @@
 
 #include <dink/lib.hpp>
 #include <dink/canonical.hpp>
+#include <dink/handle.hpp>
 #include <dink/meta.hpp>
 #include <dink/scope.hpp>
 #include <memory>
+#include <type_traits>
+#include <utility>
 
 namespace dink {
 
@@ -29,7 +32,9 @@ struct OverrideScope {
   //! Resolves local scope using provider from given binding.
   template <typename Requested, typename Container, typename Binding>
   auto execute(Container& container, Binding& binding) const
-      -> meta::RemoveRvalueRef<Requested> {
+      noexcept(noexcept(scope.template resolve<Requested>(container,
+                                                          binding.provider)))
+          -> meta::RemoveRvalueRef<Requested> {
     return scope.template resolve<Requested>(container, binding.provider);
   }
 };
@@ -43,11 +48,23 @@ struct OverrideBinding {
   //! Resolves local scope using provider from local factory.
   template <typename Requested, typename Container, typename Binding>
   auto execute(Container& container, Binding&) const
-      -> meta::RemoveRvalueRef<Requested> {
+      noexcept(is_nothrow_execute<Requested, Container>())
+          -> meta::RemoveRvalueRef<Requested> {
     using Canonical = Canonical<Requested>;
     auto provider = provider_factory.template create<Canonical>();
     return scope.template resolve<Requested>(container, provider);
   }
+
+ private:
+  template <typename Requested, typename Container>
+  static constexpr auto is_nothrow_execute() noexcept -> bool {
+    using Provider = decltype(std::declval<const ProviderFactory&>()
+                                  .template create<Canonical<Requested>>());
+    return noexcept(std::declval<const ProviderFactory&>()
+                        .template create<Canonical<Requested>>()) &&
+           noexcept(std::declval<const Scope&>().template resolve<Requested>(
+               std::declval<Container&>(), std::declval<Provider&>()));
+  }
 };
 
 namespace non_owning_shared_ptr {
@@ -78,7 +95,7 @@ struct Provider {
 template <template <typename> class Provider = Provider>
 struct ProviderFactory {
   template <typename Canonical>
-  constexpr auto create() const -> Provider<Canonical> {
+  constexpr auto create() const noexcept -> Provider<Canonical> {
     return {};
   }
 };
@@ -90,12 +107,27 @@ struct ProviderFactory {
 struct UseBinding {
   template <typename Requested, typename Container, typename Binding>
   auto execute(Container& container, Binding& binding) const
-      -> meta::RemoveRvalueRef<Requested> {
+      noexcept(noexcept(binding.scope.template resolve<Requested>(
+          container, binding.provider))) -> meta::RemoveRvalueRef<Requested> {
     return binding.scope.template resolve<Requested>(container,
                                                      binding.provider);
   }
 };
 
+//! Creates a handle, like Lazy or Provider, bound to the container.
+//
+// The binding is not used here. It is found again when the handle resolves
+// its requested type through the container.
+struct CreateHandle {
+  template <typename Requested, typename Container, typename Binding>
+  auto execute(Container& container, Binding&) const
+      noexcept(std::is_nothrow_constructible_v<
+               meta::RemoveRvalueRef<Requested>, Container&>)
+          -> meta::RemoveRvalueRef<Requested> {
+    return meta::RemoveRvalueRef<Requested>{container};
+  }
+};
+
 //! Overrides scope with singleton.
 using PromoteToSingleton = implementations::OverrideScope<scope::Singleton>;
 
@@ -120,23 +152,31 @@ struct StrategyFactory {
   //! Instantiates strategy chosen by dispatch logic.
   //
   // This function is a decision tree based on the requested type, whether a
-  // binding was found or not, and whether the scope provides references or
-  // transient values.
+  // binding was found or not, whether the scope provides references or
+  // transient values, and whether it provides its own shared_ptrs.
   //
   // \returns strategies of varying type
   // The return type varies with the strategy chosen. The strategies types
   // themselves are unrelated.
   template <typename Requested, bool found_binding,
-            bool scope_provides_references>
+            bool scope_provides_references, bool scope_provides_shared_ptrs>
   constexpr auto create() const noexcept -> auto {
-    if constexpr (meta::IsSharedPtr<Requested> || meta::IsWeakPtr<Requested>) {
+    if constexpr (IsHandle<Requested>) {
+      // Handle; resolution happens later, through the handle.
+      static_assert(!std::is_lvalue_reference_v<Requested>,
+                    "Handles must be requested by value.");
+      return strategies::CreateHandle{};
+    } else if constexpr (meta::IsSharedPtr<Requested> ||
+                         meta::IsWeakPtr<Requested>) {
       // shared_ptr or weak_ptr.
-      if constexpr (meta::IsSharedPtr<Requested> && found_binding &&
-                    !scope_provides_references) {
-        // shared_ptr bound transient; use the binding.
+      if constexpr (found_binding && scope_provides_shared_ptrs &&
+                    (meta::IsSharedPtr<Requested> ||
+                     scope_provides_references)) {
+        // Bound to a scope that provides shared_ptrs, and for weak_ptrs, also
+        // keeps one alive; use the binding.
         return strategies::UseBinding{};
       } else {
-        // weak_ptr, reference scope, or binding not found; cache shared_ptr.
+        // Otherwise, or binding not found; cache shared_ptr.
         return strategies::CacheSharedPtr{};
       }
     } else if constexpr (std::is_lvalue_reference_v<Requested> ||
@@ -150,7 +190,7 @@ struct StrategyFactory {
         return strategies::PromoteToSingleton{};
       }
     } else {
-      // Value, rvalue ref, or unique_ptr.
+      // Value, rvalue ref, unique_ptr, or InlinePoly.
       return strategies::UseBinding{};
     }
   }
@@ -3,6 +3,7 @@
 // SPDX-License-Identifier: MIT
 
 #include "strategy.hpp"
+#include <dink/lazy.hpp>
 #include <dink/test.hpp>
 
 namespace dink {
@@ -56,6 +57,16 @@ struct StrategyTest : Test {
     Scope scope;
     Provider provider;
   };
+
+  // Container that can back a handle.
+  struct LazyContainer {
+    Requested requested{};
+
+    template <typename>
+    auto resolve() -> Requested& {
+      return requested;
+    }
+  };
 };
 
 }  // namespace
@@ -133,6 +144,18 @@ TEST_F(StrategyTest, UseBinding) {
   ASSERT_EQ(&binding.scope, actual.scope);
 }
 
+TEST_F(StrategyTest, CreateHandle) {
+  using Sut = CreateHandle;
+  auto sut = Sut{};
+  auto container = LazyContainer{};
+  auto binding = Binding{};
+
+  auto actual =
+      sut.template execute<Lazy<Requested&, LazyContainer>>(container, binding);
+
+  ASSERT_EQ(&container.requested, &actual.get());
+}
+
 }  // namespace
 }  // namespace strategies
 
@@ -148,12 +171,16 @@ struct StrategyFactoryTest : StrategyTest {
   using Sut = StrategyFactory;
   Sut sut{};
 
+  // Scopes providing references provide no shared_ptrs of their own, unless
+  // stated otherwise, as with PerGraph.
   template <typename Expected, typename Requested, bool found_binding,
-            bool scope_provides_references>
+            bool scope_provides_references,
+            bool scope_provides_shared_ptrs = !scope_provides_references>
   static constexpr auto test =
       std::same_as<Expected,
                    decltype(sut.template create<Requested, found_binding,
-                                                scope_provides_references>())>;
+                                                scope_provides_references,
+                                                scope_provides_shared_ptrs>())>;
 
   static_assert(test<UseBinding, std::unique_ptr<Requested>, false, false>);
   static_assert(test<UseBinding, std::unique_ptr<Requested>, false, true>);
@@ -164,16 +191,24 @@ struct StrategyFactoryTest : StrategyTest {
   static_assert(test<CacheSharedPtr, std::shared_ptr<Requested>, false, true>);
   static_assert(test<UseBinding, std::shared_ptr<Requested>, true, false>);
   static_assert(test<CacheSharedPtr, std::shared_ptr<Requested>, true, true>);
+  static_assert(
+      test<UseBinding, std::shared_ptr<Requested>, true, true, true>);
+  static_assert(
+      test<CacheSharedPtr, std::shared_ptr<Requested>, false, true, true>);
 
   static_assert(test<CacheSharedPtr, std::weak_ptr<Requested>, false, false>);
   static_assert(test<CacheSharedPtr, std::weak_ptr<Requested>, false, true>);
   static_assert(test<CacheSharedPtr, std::weak_ptr<Requested>, true, false>);
   static_assert(test<CacheSharedPtr, std::weak_ptr<Requested>, true, true>);
+  static_assert(test<UseBinding, std::weak_ptr<Requested>, true, true, true>);
+  static_assert(
+      test<CacheSharedPtr, std::weak_ptr<Requested>, false, true, true>);
 
   static_assert(test<PromoteToSingleton, Requested&, false, false>);
   static_assert(test<PromoteToSingleton, Requested&, false, true>);
   static_assert(test<PromoteToSingleton, Requested&, true, false>);
   static_assert(test<UseBinding, Requested&, true, true>);
+  static_assert(test<UseBinding, Requested&, true, true, true>);
 
   static_assert(test<PromoteToSingleton, Requested*, false, false>);
   static_assert(test<PromoteToSingleton, Requested*, false, true>);
@@ -189,6 +224,12 @@ struct StrategyFactoryTest : StrategyTest {
   static_assert(test<UseBinding, Requested&&, false, true>);
   static_assert(test<UseBinding, Requested&&, true, false>);
   static_assert(test<UseBinding, Requested&&, true, true>);
+
+  using Handle = Lazy<Requested&, AnyContainer>;
+  static_assert(test<CreateHandle, Handle, false, false>);
+  static_assert(test<CreateHandle, Handle, false, true>);
+  static_assert(test<CreateHandle, Handle, true, false>);
+  static_assert(test<CreateHandle, Handle, true, true>);
 };
 
 }  // namespace
@@ -0,0 +1,278 @@
+// \file
+// Copyright (c) 2025 Frank Secilia
+// SPDX-License-Identifier: MIT
+//
+// \brief Transient unique_ptr trees allocated as one block.
+//
+// Resolving a unique_ptr makes one allocation, and a type that owns its
+// dependencies through unique_ptrs makes one more per dependency, recursively.
+// A tree whose edges are TreeUniquePtrs can instead be resolved into a single
+// block:
+//
+//   struct Pipeline {
+//     using dink_inject = Pipeline(TreeUniquePtr<Parser>, TreeUniquePtr<Sink>);
+//     Pipeline(TreeUniquePtr<Parser>, TreeUniquePtr<Sink>);
+//   };
+//
+//   auto pipeline = container.resolve_tree<Pipeline>();
+//
+// The block is sized at compile time from the declared injection of each type
+// in the tree, and allocated once. The root is placed at its start and each
+// node after it. Every node shares ownership of the block, so deleting the
+// root destroys the whole tree and frees the block, and a node moved out of
+// its parent keeps the block alive until it is deleted, too.
+//
+// Only requests for TreeUniquePtr made while constructing a node of the tree
+// are placed in the block. Everything else, including the dependencies of
+// non-tree instances and anything cached, resolves through the container
+// normally, since it may outlive the tree. Nodes that don't fit, because their
+// types don't declare their injection or are bound to larger implementations,
+// are allocated individually instead.
+//
+// Outside resolve_tree(), a TreeUniquePtr is an ordinary heap-allocated
+// unique_ptr, so the same types resolve either way.
+
+#pragma once
+
+#include <dink/lib.hpp>
+#include <dink/adapter.hpp>
+#include <dink/emplace.hpp>
+#include <dink/inject.hpp>
+#include <dink/meta.hpp>
+#include <dink/type_list.hpp>
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <new>
+#include <type_traits>
+
+namespace dink {
+namespace tree {
+
+//! Header at the start of a block, counting the owners of the block.
+//
+// Each node in the block owns a share of it, as does the container placing
+// nodes in it, so nodes may be deleted in any order.
+struct Block {
+  std::atomic<std::size_t> num_owners{1};
+
+  auto acquire() noexcept -> void {
+    num_owners.fetch_add(1, std::memory_order_relaxed);
+  }
+
+  //! Releases a share, freeing the block if it was the last.
+  auto release() noexcept -> void {
+    if (num_owners.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+      this->~Block();
+      ::operator delete(this);
+    }
+  }
+};
+
+//! Deletes a tree node according to where it was allocated.
+//
+// Nodes allocated individually are deleted. Nodes in a block are destroyed in
+// place, then release their share of the block.
+class Deleter {
+ public:
+  template <typename Instance>
+  auto operator()(Instance* instance) const noexcept -> void {
+    if (!block_) {
+      delete instance;
+      return;
+    }
+
+    instance->~Instance();
+    block_->release();
+  }
+
+  //! Deleter for a node in block, taking a share of it.
+  static auto in_block(Block& block) noexcept -> Deleter {
+    block.acquire();
+    return Deleter{&block};
+  }
+
+  //! Deleter for an individually allocated node.
+  constexpr Deleter() noexcept = default;
+
+  //! Adopts the nodes of unique_ptrs created by new.
+  template <typename Instance>
+  constexpr Deleter(std::default_delete<Instance>) noexcept {}
+
+ private:
+  explicit constexpr Deleter(Block* block) noexcept : block_{block} {}
+
+  Block* block_ = nullptr;
+};
+
+}  // namespace tree
+
+//! unique_ptr whose instance may be a node of a tree allocated as one block.
+//
+// A node may be moved out of its tree; it keeps the block alive.
+//
+// \sa Container::resolve_tree()
+template <typename Instance>
+using TreeUniquePtr = std::unique_ptr<Instance, tree::Deleter>;
+
+namespace tree {
+
+// ----------------------------------------------------------------------------
+// Footprint
+// ----------------------------------------------------------------------------
+
+//! Alignment of every node in a block.
+//
+// Blocks come from operator new, so nodes are placed at multiples of its
+// alignment. Overaligned types are allocated individually.
+inline constexpr std::size_t alignment = __STDCPP_DEFAULT_NEW_ALIGNMENT__;
+
+//! Size of Instance's node, padded so the next node stays aligned.
+template <typename Instance>
+inline constexpr std::size_t node_size =
+    (sizeof(Instance) + alignment - 1) / alignment * alignment;
+
+namespace detail {
+
+template <typename Instance>
+struct Footprint;
+
+//! Footprint of the subtree behind one request; 0 unless it is a tree edge.
+template <typename Requested>
+struct EdgeFootprint {
+  static constexpr std::size_t value = 0;
+};
+
+template <typename Instance>
+struct EdgeFootprint<TreeUniquePtr<Instance>> : Footprint<Instance> {};
+
+template <typename Requests>
+struct EdgesFootprint;
+
+template <typename... Requests>
+struct EdgesFootprint<TypeList<Requests...>> {
+  static constexpr std::size_t value =
+      (EdgeFootprint<std::remove_cvref_t<Requests>>::value + ... + 0);
+};
+
+template <typename Instance>
+struct Footprint {
+  static constexpr std::size_t value =
+      node_size<Instance> +
+      EdgesFootprint<InjectDependencies<Instance>>::value;
+};
+
+}  // namespace detail
+
+//! Bytes needed to place Root and its declared tree in one block.
+template <typename Root>
+inline constexpr std::size_t footprint = detail::Footprint<Root>::value;
+
+// ----------------------------------------------------------------------------
+// Allocation
+// ----------------------------------------------------------------------------
+
+//! Storage for one node, and the block it is in.
+//
+// address is null if the node must be allocated individually.
+struct Node {
+  void* address = nullptr;
+  Block* block = nullptr;
+
+  //! Takes ownership of instance, constructed at address.
+  template <typename Instance>
+  auto own(Instance* instance) const noexcept -> TreeUniquePtr<Instance> {
+    return TreeUniquePtr<Instance>{instance, Deleter::in_block(*block)};
+  }
+};
+
+}  // namespace tree
+
+// ----------------------------------------------------------------------------
+// TreeContainer
+// ----------------------------------------------------------------------------
+
+//! Container adapter that places one tree's nodes in a single block.
+//
+// This is created on the stack by resolve_root(), for
+// Container::resolve_tree(). Like OverridingContainer, it dispatches with the
+// container's own dispatcher, config, and parent, passing itself as the
+// container, but only for TreeUniquePtr requests. Invokers constructing those
+// ask it for their node's storage. Every other request resolves through the
+// underlying container, so the tree only spans TreeUniquePtr edges.
+//
+// The block is allocated up front. The first node placed is the root's, just
+// after the block's header. Each node takes a share of the block once it is
+// constructed, and this releases its own share when it is destroyed. If
+// resolution throws, the nodes already constructed are destroyed as the
+// exception unwinds, and the block is freed here.
+template <typename Container, typename Dispatcher, typename Config,
+          typename ParentPtr>
+class TreeContainer
+    : public DispatchingContainer<
+          TreeContainer<Container, Dispatcher, Config, ParentPtr>, Container,
+          Dispatcher, Config, ParentPtr> {
+ public:
+  //! Dispatches tree edges with this as the container; forwards the rest.
+  template <typename Requested>
+  auto resolve() -> meta::RemoveRvalueRef<Requested> {
+    if constexpr (meta::IsTreeUniquePtr<Requested>) {
+      return this->template dispatch<Requested>(*this);
+    } else {
+      return this->container_.template resolve<Requested>();
+    }
+  }
+
+  //! Resolves every contribution to the set of Element.
+  //
+  // Elements aren't nodes of the tree, so this forwards, too.
+  template <typename Element>
+  auto resolve_set() -> auto {
+    return this->container_.template resolve_set<Element>();
+  }
+
+  //! Resolves Root into a block sized for its declared tree.
+  template <IsEmplaceable Root>
+  static auto resolve_root(Container& container, Dispatcher& dispatcher,
+                           Config& config, ParentPtr parent)
+      -> TreeUniquePtr<Root> {
+    auto tree_container = TreeContainer{container, dispatcher, config, parent,
+                                        tree::footprint<Root>};
+    return tree_container.template resolve<TreeUniquePtr<Root>>();
+  }
+
+  //! Takes the next node of the block for Constructed, if it fits.
+  template <typename Constructed>
+  auto allocate_node() noexcept -> tree::Node {
+    constexpr auto size = tree::node_size<Constructed>;
+    if (alignof(Constructed) > tree::alignment || size > capacity_ - used_) {
+      return {};
+    }
+
+    auto* const address = reinterpret_cast<std::byte*>(block_) + header_size +
+                          used_;
+    used_ += size;
+    return {address, block_};
+  }
+
+  TreeContainer(Container& container, Dispatcher& dispatcher, Config& config,
+                ParentPtr parent, std::size_t capacity)
+      : TreeContainer::DispatchingContainer{container, dispatcher, config,
+                                            parent},
+        block_{::new (::operator new(header_size + capacity)) tree::Block{}},
+        capacity_{capacity} {}
+
+  ~TreeContainer() { block_->release(); }
+
+  TreeContainer(const TreeContainer&) = delete;
+  auto operator=(const TreeContainer&) -> TreeContainer& = delete;
+
+ private:
+  static constexpr auto header_size = tree::node_size<tree::Block>;
+
+  tree::Block* block_;
+  std::size_t capacity_;
+  std::size_t used_ = 0;
+};
+
+}  // namespace dink
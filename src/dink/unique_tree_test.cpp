@@ -0,0 +1,226 @@
+// \file
+// Copyright (c) 2025 Frank Secilia
+// SPDX-License-Identifier: MIT
+
+#include "unique_tree.hpp"
+#include <dink/test.hpp>
+#include <dink/binding_dsl.hpp>
+#include <dink/container.hpp>
+#include <cstddef>
+#include <memory>
+#include <stdexcept>
+#include <utility>
+
+namespace dink {
+namespace {
+
+struct UniqueTreeTest : Test {
+  static inline int_t num_destroyed = 0;
+
+  struct Counted {
+    Counted() = default;
+    Counted(const Counted&) = default;
+    auto operator=(const Counted&) -> Counted& = default;
+    ~Counted() { ++num_destroyed; }
+  };
+
+  struct Leaf : Counted {
+    using dink_inject = Leaf();
+  };
+
+  struct Branch : Counted {
+    using dink_inject = Branch(TreeUniquePtr<Leaf>, TreeUniquePtr<Leaf>);
+    Branch(TreeUniquePtr<Leaf> left, TreeUniquePtr<Leaf> right) noexcept
+        : left{std::move(left)}, right{std::move(right)} {}
+
+    TreeUniquePtr<Leaf> left;
+    TreeUniquePtr<Leaf> right;
+  };
+
+  // Shared instances may outlive a tree, so their edges are not part of it.
+  struct Shared {
+    using dink_inject = Shared(TreeUniquePtr<Leaf>);
+    explicit Shared(TreeUniquePtr<Leaf> leaf) noexcept
+        : leaf{std::move(leaf)} {}
+
+    TreeUniquePtr<Leaf> leaf;
+  };
+
+  struct Root : Counted {
+    using dink_inject = Root(TreeUniquePtr<Branch>, TreeUniquePtr<Leaf>,
+                             std::shared_ptr<Shared>);
+    Root(TreeUniquePtr<Branch> branch, TreeUniquePtr<Leaf> leaf,
+         std::shared_ptr<Shared> shared) noexcept
+        : branch{std::move(branch)},
+          leaf{std::move(leaf)},
+          shared{std::move(shared)} {}
+
+    TreeUniquePtr<Branch> branch;
+    TreeUniquePtr<Leaf> leaf;
+    std::shared_ptr<Shared> shared;
+  };
+
+  struct Fields {
+    TreeUniquePtr<Leaf> leaf;
+    using dink_inject = InjectFields<&Fields::leaf>;
+  };
+
+  struct Interface {
+    virtual ~Interface() { ++num_destroyed; }
+  };
+
+  struct Large : Interface {
+    std::byte padding[4 * tree::alignment];
+  };
+
+  struct HasInterface {
+    using dink_inject = HasInterface(TreeUniquePtr<Interface>);
+    explicit HasInterface(TreeUniquePtr<Interface> instance) noexcept
+        : instance{std::move(instance)} {}
+
+    TreeUniquePtr<Interface> instance;
+  };
+
+  // Throws after its dependencies are constructed.
+  struct Throwing {
+    using dink_inject = Throwing(TreeUniquePtr<Leaf>);
+    explicit Throwing(TreeUniquePtr<Leaf>) {
+      throw std::runtime_error{"construction failed"};
+    }
+  };
+
+  //! true if node lies in the block starting at root.
+  template <typename Root>
+  static auto in_block(const TreeUniquePtr<Root>& root, const void* node)
+      -> bool {
+    const auto* begin = reinterpret_cast<const std::byte*>(root.get());
+    const auto* address = static_cast<const std::byte*>(node);
+    return begin < address && address < begin + tree::footprint<Root>;
+  }
+
+  UniqueTreeTest() { num_destroyed = 0; }
+};
+
+// ----------------------------------------------------------------------------
+// Footprint
+// ----------------------------------------------------------------------------
+
+static_assert(tree::node_size<UniqueTreeTest::Leaf> == tree::alignment);
+
+// Tree edges count recursively.
+static_assert(tree::footprint<UniqueTreeTest::Branch> ==
+              tree::node_size<UniqueTreeTest::Branch> +
+                  2 * tree::node_size<UniqueTreeTest::Leaf>);
+
+// Other requests don't.
+static_assert(tree::footprint<UniqueTreeTest::Root> ==
+              tree::node_size<UniqueTreeTest::Root> +
+                  tree::footprint<UniqueTreeTest::Branch> +
+                  tree::node_size<UniqueTreeTest::Leaf>);
+
+static_assert(tree::footprint<UniqueTreeTest::Fields> ==
+              tree::node_size<UniqueTreeTest::Fields> +
+                  tree::node_size<UniqueTreeTest::Leaf>);
+
+static_assert(meta::IsTreeUniquePtr<TreeUniquePtr<UniqueTreeTest::Leaf>&&>);
+static_assert(!meta::IsTreeUniquePtr<std::unique_ptr<UniqueTreeTest::Leaf>>);
+
+// ----------------------------------------------------------------------------
+// resolve_tree
+// ----------------------------------------------------------------------------
+
+TEST_F(UniqueTreeTest, places_tree_nodes_in_one_block) {
+  auto sut = Container{};
+  const auto result = sut.resolve_tree<Root>();
+
+  ASSERT_TRUE(in_block(result, result->branch.get()));
+  ASSERT_TRUE(in_block(result, result->branch->left.get()));
+  ASSERT_TRUE(in_block(result, result->branch->right.get()));
+  ASSERT_TRUE(in_block(result, result->leaf.get()));
+}
+
+TEST_F(UniqueTreeTest, allocates_edges_of_non_tree_instances_individually) {
+  auto sut = Container{};
+  const auto result = sut.resolve_tree<Root>();
+
+  ASSERT_FALSE(in_block(result, result->shared->leaf.get()));
+}
+
+TEST_F(UniqueTreeTest, deleting_root_destroys_every_node) {
+  auto sut = Container{};
+  auto result = sut.resolve_tree<Root>();
+  auto shared = result->shared;
+
+  result.reset();
+
+  // Root, Branch, and 3 Leafs.
+  ASSERT_EQ(5, num_destroyed);
+}
+
+TEST_F(UniqueTreeTest, node_moved_out_of_tree_outlives_root) {
+  auto sut = Container{};
+  auto result = sut.resolve_tree<Branch>();
+  auto left = std::move(result->left);
+
+  result.reset();
+  ASSERT_EQ(2, num_destroyed);
+
+  // The block is only freed with its last node.
+  auto* const address = left.get();
+  left.reset();
+  ASSERT_EQ(3, num_destroyed);
+  ASSERT_NE(nullptr, address);
+}
+
+TEST_F(UniqueTreeTest, places_nodes_created_by_factories) {
+  auto sut = Container{bind<Branch>().via(
+      [](TreeUniquePtr<Leaf> left, TreeUniquePtr<Leaf> right) {
+        return Branch{std::move(left), std::move(right)};
+      })};
+  const auto result = sut.resolve_tree<Branch>();
+
+  ASSERT_TRUE(in_block(result, result->left.get()));
+  ASSERT_TRUE(in_block(result, result->right.get()));
+}
+
+TEST_F(UniqueTreeTest, places_injected_fields) {
+  auto sut = Container{};
+  const auto result = sut.resolve_tree<Fields>();
+
+  ASSERT_TRUE(in_block(result, result->leaf.get()));
+}
+
+TEST_F(UniqueTreeTest, allocates_nodes_that_dont_fit_individually) {
+  auto sut = Container{bind<Interface>().as<Large>()};
+  auto result = sut.resolve_tree<HasInterface>();
+
+  ASSERT_FALSE(in_block(result, result->instance.get()));
+
+  result.reset();
+  ASSERT_EQ(1, num_destroyed);
+}
+
+TEST_F(UniqueTreeTest, destroys_constructed_nodes_when_construction_throws) {
+  auto sut = Container{};
+
+  ASSERT_THROW(sut.resolve_tree<Throwing>(), std::runtime_error);
+  ASSERT_EQ(1, num_destroyed);
+}
+
+// ----------------------------------------------------------------------------
+// resolve
+// ----------------------------------------------------------------------------
+
+TEST_F(UniqueTreeTest, resolve_allocates_each_node_individually) {
+  auto sut = Container{};
+  auto result = sut.resolve<TreeUniquePtr<Branch>>();
+
+  ASSERT_NE(nullptr, result->left);
+  ASSERT_NE(nullptr, result->right);
+
+  result.reset();
+  ASSERT_EQ(3, num_destroyed);
+}
+
+}  // namespace
+}  // namespace dink